@@ -0,0 +1,58 @@
+import argparse
+import struct
+
+# === CLI ===
+parser = argparse.ArgumentParser(description="Converte la traccia binaria dell'occupazione dello stash nel formato CSV letto da stash_plots.py.")
+parser.add_argument('-i', '--input', required=True, help='File di input (.bin)')
+parser.add_argument('-o', '--output', required=True, help='File di output (.csv)')
+parser.add_argument('--entries', action='store_true', help="Scrive il numero di entry dello stash invece della percentuale")
+args = parser.parse_args()
+
+def read_varint(data, pos):
+    """
+    Decodifica un intero LEB128 a partire da data[pos].
+    Restituisce il valore e la posizione successiva.
+    """
+    value = 0
+    shift = 0
+    while True:
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        if byte < 0x80:
+            return value, pos
+        shift += 7
+
+def convert_stash_trace(input_file, output_file, entries):
+    """
+    Formato della traccia:
+        "STSH" | u32 versione | u32 lunghezza | configurazione "chiave=valore;..."
+        record: varint(delta clock) varint_zigzag(delta entry dello stash)
+    Ogni record diventa una riga "clock,occupazione" (percentuale rispetto a stash_size).
+    """
+    with open(input_file, 'rb') as infile:
+        data = infile.read()
+
+    if data[0:4] != b'STSH':
+        raise ValueError(f"{input_file} non è una traccia dello stash")
+    version, config_length = struct.unpack_from('<II', data, 4)
+    config_str = data[12:12 + config_length].decode('utf-8')
+    config = dict(item.split('=', 1) for item in config_str.split(';') if item)
+    stash_size = int(config['stash_size'])
+    print(f"Versione {version}: {config_str}")
+
+    pos = 12 + config_length
+    clk = 0
+    stash_entries = 0
+    with open(output_file, 'w') as outfile:
+        while pos < len(data):
+            delta_clk, pos = read_varint(data, pos)
+            zigzag, pos = read_varint(data, pos)
+            clk += delta_clk
+            stash_entries += (zigzag >> 1) ^ -(zigzag & 1)
+            occupancy = stash_entries if entries else stash_entries / stash_size * 100
+            outfile.write(f"{clk},{occupancy}\n")
+
+# Esecuzione base
+if __name__ == '__main__':
+    convert_stash_trace(args.input, args.output, args.entries)
@@ -0,0 +1,192 @@
+import argparse
+import copy
+import os
+import platform
+import subprocess
+import tempfile
+import time
+import yaml
+
+# === CLI ===
+parser = argparse.ArgumentParser(description="Run the PathORAM regression benchmarks on the bundled traces and compare them against a baseline")
+parser.add_argument('-r', '--ramulator', default='./ramulator2', help='Ramulator2 executable')
+parser.add_argument('-i', '--input', default='./config_oram_hbm2.yaml', help='Base configuration file')
+parser.add_argument('-b', '--baseline', default='./benchmarks/baseline.yaml', help='Baseline file')
+parser.add_argument('-u', '--update-baseline', action='store_true', help='Store the results as the new baseline instead of comparing them')
+parser.add_argument('-f', '--filter', default='', help='Run only the benchmarks whose name contains this string')
+parser.add_argument('--tolerance', type=float, default=0.01, help='Relative tolerance of the simulated metrics (default 1%%)')
+parser.add_argument('--host-tolerance', type=float, default=0.20, help='Relative tolerance of wall time and peak RSS (default 20%%)')
+args = parser.parse_args()
+
+TRACES = {
+  "layer5": "traces/mobilenet/layer5.trace",
+  "layer23": "traces/mobilenet/layer23.trace",
+}
+
+# One factor at a time around the reference tree (2 GB, Z=4, binary), on one and eight channels
+REFERENCE = {"length_tree": 2147483648, "z_blocks": 4, "arity": 2}
+VARIANTS = {
+  "ref": {},
+  "256MB": {"length_tree": 268435456},
+  "z8": {"z_blocks": 8},
+  "arity4": {"arity": 4},
+}
+CHANNELS = [1, 8]
+
+# Every run uses the same seed, so the simulated metrics are reproducible bit-exactly
+SEED = 1
+
+# Lower is better for all the metrics; the host ones are noisy and get their own tolerance
+HOST_METRICS = ["wall_seconds", "peak_rss_mb"]
+
+def benchmark_matrix(base_config):
+  """
+  Returns the (name, config) of every benchmark.
+  """
+  benchmarks = []
+  for trace_name, trace in TRACES.items():
+    num_lines = sum(1 for _ in open(trace))
+    for variant_name, variant in VARIANTS.items():
+      for ch in CHANNELS:
+        name = f"{trace_name}/{variant_name}/ch{ch}"
+        if args.filter not in name:
+          continue
+        config = copy.deepcopy(base_config)
+        config["Frontend"]["impl"] = "SimpleO3"
+        config["Frontend"]["traces"] = [trace]
+        config["Frontend"]["num_expected_insts"] = num_lines
+        memory_system = config["MemorySystem"]
+        memory_system.update(REFERENCE)
+        memory_system.update(variant)
+        memory_system["seed"] = SEED
+        # No file outputs: they would be timed too
+        memory_system["stash_trace_sampling"] = 0
+        memory_system["timeline_trace"] = ""
+        memory_system["epoch_cycles"] = 0
+        memory_system["DRAM"]["org"]["channel"] = ch
+        benchmarks.append((name, config))
+  return benchmarks
+
+def host_info():
+  """
+  Returns the description of the host and of the matrix stored with the baseline: wall time and
+  peak RSS are only comparable on the same host, and the metrics only on the same matrix.
+  """
+  return {
+    "host": platform.node(),
+    "machine": platform.machine(),
+    "processor": platform.processor(),
+    "system": platform.platform(),
+    "matrix": {
+      "traces": TRACES,
+      "reference": REFERENCE,
+      "variants": VARIANTS,
+      "channels": CHANNELS,
+      "seed": SEED,
+    },
+  }
+
+def find_stats(node):
+  """
+  Returns the mapping of the Ramulator2 statistics that holds the memory system counters.
+  """
+  if isinstance(node, dict):
+    if "memory_system_cycles" in node:
+      return node
+    for value in node.values():
+      stats = find_stats(value)
+      if stats is not None:
+        return stats
+  return None
+
+def run_benchmark(name, config):
+  """
+  Runs one benchmark and returns its metrics. Wall time and peak RSS are those of the
+  simulator process (wait4), not of this script.
+  """
+  with tempfile.TemporaryFile(mode="w+") as output:
+    start = time.monotonic()
+    process = subprocess.Popen([args.ramulator, "-c", yaml.safe_dump(config)], stdout=output)
+    _, status, usage = os.wait4(process.pid, 0)
+    wall_seconds = time.monotonic() - start
+    process.returncode = os.waitstatus_to_exitcode(status)
+    if process.returncode != 0:
+      raise RuntimeError(f"{name}: ramulator2 exited with {process.returncode}")
+    output.seek(0)
+    stats = find_stats(yaml.safe_load(output))
+  if stats is None:
+    raise RuntimeError(f"{name}: no memory system statistics in the output")
+
+  # Partitioned runs prefix the controller counters with partition<p>_
+  replies = sum(v for k, v in stats.items() if k.endswith("oram_controller_replies"))
+  latency = sum(v for k, v in stats.items() if k.endswith("oram_controller_cumulative_latency"))
+  return {
+    "cycles": stats["memory_system_cycles"],
+    "avg_latency": latency / replies if replies > 0 else 0.0,
+    "bandwidth_amplification": stats["oram_bandwidth_amplification"],
+    "wall_seconds": wall_seconds,
+    "peak_rss_mb": usage.ru_maxrss / 1024.0,
+  }
+
+def compare(results, baseline):
+  """
+  Prints the delta of every metric against the baseline and returns the number of regressions.
+  """
+  regressions = 0
+  meta = baseline.get("_meta", {})
+  same_host = meta.get("host") == platform.node() and meta.get("machine") == platform.machine()
+  if not same_host:
+    print(f"Baseline recorded on {meta.get('host', 'an unknown host')}: wall time and peak RSS are not compared")
+  if meta.get("matrix") not in (None, host_info()["matrix"]):
+    print("The benchmark matrix differs from the one of the baseline: store a new baseline")
+  print(f"{'benchmark':<24} {'metric':<24} {'baseline':>14} {'current':>14} {'delta':>9}")
+  for name, metrics in results.items():
+    if name not in baseline:
+      print(f"{name:<24} not in the baseline")
+      continue
+    for metric, value in metrics.items():
+      reference = baseline[name].get(metric)
+      if reference is None or (metric in HOST_METRICS and not same_host):
+        continue
+      tolerance = args.host_tolerance if metric in HOST_METRICS else args.tolerance
+      delta = (value - reference) / reference if reference != 0 else 0.0
+      flag = ""
+      if delta > tolerance:
+        flag = "REGRESSION"
+        regressions += 1
+      elif delta < -tolerance:
+        flag = "improved"
+      print(f"{name:<24} {metric:<24} {reference:>14.4f} {value:>14.4f} {delta:>+8.2%} {flag}")
+  return regressions
+
+base_config = None
+with open(args.input, 'r') as f:
+  base_config = yaml.safe_load(f)
+
+# Sequential runs: concurrent ones would disturb each other's wall time
+results = {}
+for name, config in benchmark_matrix(base_config):
+  print(f"Running {name}", flush=True)
+  results[name] = run_benchmark(name, config)
+
+if args.update_baseline:
+  baseline = {}
+  if os.path.exists(args.baseline):
+    with open(args.baseline, 'r') as f:
+      baseline = yaml.safe_load(f) or {}
+  baseline.update(results)
+  baseline["_meta"] = host_info()
+  os.makedirs(os.path.dirname(args.baseline) or ".", exist_ok=True)
+  with open(args.baseline, 'w') as f:
+    yaml.safe_dump(baseline, f)
+  print(f"Baseline of {len(results)} benchmarks stored in {args.baseline}")
+elif not os.path.exists(args.baseline):
+  # Nothing to compare against is a failure, not a pass
+  print(f"No baseline in {args.baseline}: store one with --update-baseline (make pathoram_regression_baseline) on the reference version")
+  exit(1)
+else:
+  with open(args.baseline, 'r') as f:
+    baseline = yaml.safe_load(f) or {}
+  regressions = compare(results, baseline)
+  print(f"{regressions} regressions beyond the tolerance")
+  exit(1 if regressions > 0 else 0)
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include <string>
+
+#include "base/base.h"
+#include "frontend/frontend.h"
+
+#include "frontend/impl/memory_trace/binary_trace.h"
+
+namespace Ramulator {
+
+/**
+ * @class BinaryTraceFrontEnd
+ * @brief Replays a binary trace (see binary_trace.h) from a memory mapping of the file.
+ *
+ * Each record waits its bubble count in frontend cycles, then sends its request (a write if the
+ * type bit is set, a read otherwise) and, if present, the writeback of the SimpleO3 line. A request
+ * refused by the memory system is retried on the next cycle.
+ */
+class BinaryTraceFrontEnd : public IFrontEnd, public Implementation {
+  RAMULATOR_REGISTER_IMPLEMENTATION(IFrontEnd, BinaryTraceFrontEnd, "BinaryTrace", "Memory-mapped binary memory trace.")
+
+  private:
+    BinaryTraceReader reader;
+    BinaryTraceRecord record;
+    bool has_record = false;
+    bool request_sent = false;
+    uint64_t bubbles_left = 0;
+
+  public:
+    void init() override {
+      std::string path = param<std::string>("path").desc("Path to the binary trace file.").required();
+      m_clock_ratio = param<uint>("clock_ratio").required();
+      reader.open(path);
+    };
+
+    void tick() override {
+      if(!has_record) {
+        if(!reader.next(record)) return;
+        has_record = true;
+        request_sent = false;
+        bubbles_left = record.bubbles;
+      }
+      if(bubbles_left > 0) {
+        bubbles_left--;
+        return;
+      }
+      if(!request_sent) {
+        Request req(record.addr, record.is_write ? Request::Type::Write : Request::Type::Read);
+        if(!m_memory_system->send(req)) return;
+        request_sent = true;
+        has_record = record.has_writeback;
+        return;
+      }
+      Request writeback(record.writeback_addr, Request::Type::Write);
+      if(m_memory_system->send(writeback)) {
+        has_record = false;
+      }
+    };
+
+    bool is_finished() override {
+      return reader.is_done() && !has_record;
+    };
+};
+
+}   // namespace Ramulator
\ No newline at end of file
@@ -0,0 +1,181 @@
+#ifndef BINARY_TRACE_H
+#define BINARY_TRACE_H
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Ramulator {
+
+/**
+ * Compact binary memory trace, produced by `pathoram_trace_converter` from the text formats.
+ *
+ * Layout (little endian):
+ *   header:  magic "ORTB" | uint32 version | uint64 number of records
+ *   record:  varint (bubbles << 2 | is_write << 1 | has_writeback)
+ *            zigzag varint (addr - addr of the previous record)
+ *            zigzag varint (writeback_addr - addr)            only if has_writeback
+ *
+ * A record carries the same information as a SimpleO3 line (`bubbles addr [writeback_addr]`),
+ * plus the type bit of the load/store traces. Addresses are delta-encoded, so the sequential
+ * streams of the DNN traces take one or two bytes per record.
+ */
+struct BinaryTraceRecord {
+    uint64_t bubbles = 0;
+    bool is_write = false;
+    bool has_writeback = false;
+    int64_t addr = 0;
+    int64_t writeback_addr = 0;
+};
+
+namespace BinaryTrace {
+    constexpr char magic[4] = {'O', 'R', 'T', 'B'};
+    constexpr uint32_t version = 1;
+    constexpr size_t header_size = sizeof(magic) + sizeof(uint32_t) + sizeof(uint64_t);
+
+    inline uint64_t zigzag_encode(int64_t value) { return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63); }
+    inline int64_t zigzag_decode(uint64_t value) { return (int64_t)(value >> 1) ^ -(int64_t)(value & 1); }
+}
+
+/**
+ * @class BinaryTraceWriter
+ * @brief Appends records to a binary trace. The number of records in the header is written by close().
+ */
+class BinaryTraceWriter {
+    private:
+        std::ofstream file;
+        uint64_t num_records = 0;
+        int64_t prev_addr = 0;
+
+        void write_varint(uint64_t value) {
+            char buffer[10];
+            int length = 0;
+            while (value >= 0x80) {
+                buffer[length++] = (char)(value | 0x80);
+                value >>= 7;
+            }
+            buffer[length++] = (char)value;
+            file.write(buffer, length);
+        }
+
+    public:
+        explicit BinaryTraceWriter(const std::string& path) : file(path, std::ios::binary) {
+            if (!file) throw std::runtime_error("BinaryTraceWriter: cannot open " + path);
+            uint64_t placeholder = 0;
+            file.write(BinaryTrace::magic, sizeof(BinaryTrace::magic));
+            file.write(reinterpret_cast<const char*>(&BinaryTrace::version), sizeof(BinaryTrace::version));
+            file.write(reinterpret_cast<const char*>(&placeholder), sizeof(placeholder));
+        }
+
+        void write(const BinaryTraceRecord& record) {
+            write_varint(record.bubbles << 2 | (uint64_t)record.is_write << 1 | (uint64_t)record.has_writeback);
+            write_varint(BinaryTrace::zigzag_encode(record.addr - prev_addr));
+            if (record.has_writeback) write_varint(BinaryTrace::zigzag_encode(record.writeback_addr - record.addr));
+            prev_addr = record.addr;
+            num_records++;
+        }
+
+        uint64_t close() {
+            file.seekp(sizeof(BinaryTrace::magic) + sizeof(BinaryTrace::version));
+            file.write(reinterpret_cast<const char*>(&num_records), sizeof(num_records));
+            file.close();
+            if (!file) throw std::runtime_error("BinaryTraceWriter: write error");
+            return num_records;
+        }
+};
+
+/**
+ * @class BinaryTraceReader
+ * @brief Streams the records of a binary trace straight from a read-only memory mapping of the file:
+ * nothing is parsed or copied up front, pages are faulted in as the trace is consumed.
+ */
+class BinaryTraceReader {
+    private:
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+        size_t offset = 0;
+        uint64_t num_records = 0;
+        uint64_t records_read = 0;
+        int64_t prev_addr = 0;
+
+        uint64_t read_varint() {
+            uint64_t value = 0;
+            for (int shift = 0; offset < size && shift < 64; shift += 7) {
+                uint8_t byte = data[offset++];
+                value |= (uint64_t)(byte & 0x7f) << shift;
+                if (!(byte & 0x80)) return value;
+            }
+            throw std::runtime_error("BinaryTraceReader: truncated record");
+        }
+
+    public:
+        BinaryTraceReader() = default;
+        BinaryTraceReader(const BinaryTraceReader&) = delete;
+        BinaryTraceReader& operator=(const BinaryTraceReader&) = delete;
+        ~BinaryTraceReader() { close(); }
+
+        void open(const std::string& path) {
+            close();
+            int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0) throw std::runtime_error("BinaryTraceReader: cannot open " + path);
+            struct stat st;
+            if (fstat(fd, &st) != 0 || (size_t)st.st_size < BinaryTrace::header_size) {
+                ::close(fd);
+                throw std::runtime_error("BinaryTraceReader: " + path + " is not a binary trace");
+            }
+            size = st.st_size;
+            void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            ::close(fd);
+            if (mapping == MAP_FAILED) throw std::runtime_error("BinaryTraceReader: cannot map " + path);
+            madvise(mapping, size, MADV_SEQUENTIAL);
+            data = static_cast<const uint8_t*>(mapping);
+
+            uint32_t file_version;
+            std::memcpy(&file_version, data + sizeof(BinaryTrace::magic), sizeof(file_version));
+            if (std::memcmp(data, BinaryTrace::magic, sizeof(BinaryTrace::magic)) != 0 || file_version != BinaryTrace::version) {
+                close();
+                throw std::runtime_error("BinaryTraceReader: " + path + " is not a binary trace (version " + std::to_string(BinaryTrace::version) + ")");
+            }
+            std::memcpy(&num_records, data + sizeof(BinaryTrace::magic) + sizeof(file_version), sizeof(num_records));
+            offset = BinaryTrace::header_size;
+        }
+
+        void close() {
+            if (data != nullptr) munmap(const_cast<uint8_t*>(data), size);
+            data = nullptr;
+            size = offset = 0;
+            num_records = records_read = 0;
+            prev_addr = 0;
+        }
+
+        /**
+         * @brief Decodes the next record into `record`. Returns false at the end of the trace.
+         */
+        bool next(BinaryTraceRecord& record) {
+            if (records_read == num_records) return false;
+            uint64_t flags = read_varint();
+            record.bubbles = flags >> 2;
+            record.is_write = flags & 2;
+            record.has_writeback = flags & 1;
+            record.addr = prev_addr + BinaryTrace::zigzag_decode(read_varint());
+            record.writeback_addr = record.has_writeback ? record.addr + BinaryTrace::zigzag_decode(read_varint()) : 0;
+            prev_addr = record.addr;
+            records_read++;
+            return true;
+        }
+
+        uint64_t get_num_records() const { return num_records; }
+        uint64_t get_records_read() const { return records_read; }
+        bool is_done() const { return records_read == num_records; }
+};
+
+}   // namespace Ramulator
+
+#endif   // BINARY_TRACE_H
\ No newline at end of file
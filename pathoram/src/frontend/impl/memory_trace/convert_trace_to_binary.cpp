@@ -0,0 +1,83 @@
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "frontend/impl/memory_trace/binary_trace.h"
+
+/**
+ * Converts a text trace into the binary trace format (see binary_trace.h). Each line can be:
+ *   SimpleO3       `bubbles addr [writeback_addr]`   (decimal)
+ *   simple_trace   `LD addr` / `ST addr writeback_addr`   (hex), as convert_trace_to_simpleo3.py
+ *   load/store     `LD addr` / `ST addr`   (hex or decimal), a store becomes a write
+ *
+ * Usage: pathoram_trace_converter <input.trace> <output.bin>
+ */
+
+namespace Ramulator {
+
+int64_t parse_addr(const std::string& token) {
+    if (token.size() > 2 && token[0] == '0' && (token[1] == 'x' || token[1] == 'X')) {
+        return (int64_t)std::stoull(token.substr(2), nullptr, 16);
+    }
+    return (int64_t)std::stoull(token, nullptr, 10);
+}
+
+/**
+ * @brief Parses one text line into `record`. Returns false for empty lines.
+ */
+bool parse_line(const std::string& line, BinaryTraceRecord& record) {
+    std::istringstream tokens(line);
+    std::string first, addr, writeback;
+    if (!(tokens >> first)) return false;
+    if (!(tokens >> addr)) throw std::runtime_error("missing address");
+    bool has_writeback = static_cast<bool>(tokens >> writeback);
+
+    record = BinaryTraceRecord();
+    if (first == "LD" || first == "ST") {
+        record.is_write = first == "ST" && !has_writeback;
+    } else {
+        record.bubbles = std::stoull(first);
+    }
+    record.addr = parse_addr(addr);
+    record.has_writeback = has_writeback;
+    if (has_writeback) record.writeback_addr = parse_addr(writeback);
+    return true;
+}
+
+}   // namespace Ramulator
+
+int main(int argc, char** argv) {
+    using namespace Ramulator;
+    if (argc != 3) {
+        std::fprintf(stderr, "Usage: %s <input.trace> <output.bin>\n", argv[0]);
+        return 1;
+    }
+
+    std::ifstream input(argv[1]);
+    if (!input) {
+        std::fprintf(stderr, "Cannot open %s\n", argv[1]);
+        return 1;
+    }
+
+    try {
+        BinaryTraceWriter writer(argv[2]);
+        BinaryTraceRecord record;
+        std::string line;
+        size_t line_number = 0;
+        while (std::getline(input, line)) {
+            line_number++;
+            try {
+                if (parse_line(line, record)) writer.write(record);
+            } catch (const std::exception& e) {
+                throw std::runtime_error(std::string(argv[1]) + ":" + std::to_string(line_number) + ": " + e.what());
+            }
+        }
+        uint64_t num_records = writer.close();
+        std::printf("%s: %llu records\n", argv[2], (unsigned long long)num_records);
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "%s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,179 @@
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "base/base.h"
+#include "frontend/frontend.h"
+
+namespace Ramulator {
+
+/**
+ * @class ZipfDistribution
+ * @brief Zipf distribution over the ranks [1, n] with exponent `skew`, sampled in constant time and
+ * memory by rejection-inversion (Hörmann and Derflinger, 1996), so the working set can be large.
+ */
+class ZipfDistribution {
+  private:
+    uint64_t n;
+    double skew;
+    double h_integral_x1;
+    double h_integral_n;
+    double s;
+
+    static double helper1(double x) { return std::abs(x) > 1e-8 ? std::log1p(x) / x : 1 - x * (0.5 - x * (1.0 / 3 - 0.25 * x)); }
+    static double helper2(double x) { return std::abs(x) > 1e-8 ? std::expm1(x) / x : 1 + x * 0.5 * (1 + x / 3 * (1 + 0.25 * x)); }
+
+    double h(double x) const { return std::exp(-skew * std::log(x)); }
+
+    double h_integral(double x) const {
+      double log_x = std::log(x);
+      return helper2((1 - skew) * log_x) * log_x;
+    }
+
+    double h_integral_inverse(double x) const {
+      double t = std::max(x * (1 - skew), -1.0);
+      return std::exp(helper1(t) * x);
+    }
+
+  public:
+    ZipfDistribution(uint64_t n = 1, double skew = 1.0) : n(n), skew(skew) {
+      h_integral_x1 = h_integral(1.5) - 1;
+      h_integral_n = h_integral(n + 0.5);
+      s = 2 - h_integral_inverse(h_integral(2.5) - h(2));
+    }
+
+    template <typename Generator>
+    uint64_t operator()(Generator& rng) {
+      std::uniform_real_distribution<double> uniform(0.0, 1.0);
+      while(true) {
+        double u = h_integral_n + uniform(rng) * (h_integral_x1 - h_integral_n);
+        double x = h_integral_inverse(u);
+        uint64_t k = (uint64_t)std::clamp<double>(x + 0.5, 1, n);
+        if(k - x <= s || u >= h_integral(k + 0.5) - h(k)) return k;
+      }
+    }
+};
+
+/**
+ * @class SyntheticGenerator
+ * @brief Frontend that generates the block requests on the fly instead of replaying a trace.
+ *
+ * Addresses are block ids in [base_block, base_block + working_set), drawn from the `pattern`:
+ * uniform, zipf (rank 1 is base_block), sequential, strided, or mix (one pattern per request,
+ * picked with `mix_weights` in the order uniform, zipf, sequential, strided).
+ * In closed loop at most `outstanding` requests wait for their reply; in open loop `rate` requests
+ * per frontend cycle are issued regardless of the replies (the backlog is retried in order).
+ */
+class SyntheticGenerator : public IFrontEnd, public Implementation {
+  RAMULATOR_REGISTER_IMPLEMENTATION(IFrontEnd, SyntheticGenerator, "SyntheticGenerator", "Synthetic block request generator.")
+
+  private:
+    enum class Pattern : int {Uniform, Zipf, Sequential, Strided, Mix};
+    const std::vector<std::string> pattern_names = {"uniform", "zipf", "sequential", "strided", "mix"};
+
+    Pattern pattern;
+    uint64_t base_block;
+    uint64_t working_set;
+    uint64_t stride;
+    float read_ratio;
+    bool closed_loop;
+    int max_outstanding;
+    float rate;
+    size_t num_requests;
+
+    std::mt19937_64 rng;
+    std::uniform_int_distribution<uint64_t> uniform_block;
+    ZipfDistribution zipf_rank;
+    std::discrete_distribution<int> mix_pattern;
+    std::bernoulli_distribution is_read;
+    uint64_t sequential_cursor = 0;
+    uint64_t strided_cursor = 0;
+
+    float issue_credit = 0;
+    bool has_pending = false;
+    Addr_t pending_addr = 0;
+    int pending_type = Request::Type::Read;
+
+    size_t issued = 0;
+    size_t completed = 0;
+    int outstanding = 0;
+
+    uint64_t next_block(Pattern p) {
+      switch(p) {
+        case Pattern::Uniform: return uniform_block(rng);
+        case Pattern::Zipf: return zipf_rank(rng) - 1;
+        case Pattern::Sequential: return sequential_cursor++ % working_set;
+        case Pattern::Strided: {
+          uint64_t block = strided_cursor % working_set;
+          strided_cursor += stride;
+          return block;
+        }
+        default: return next_block(static_cast<Pattern>(mix_pattern(rng)));
+      }
+    }
+
+    bool send_pending() {
+      Request req(pending_addr, pending_type, 0, [this](Request& r) {
+        this->outstanding--;
+        this->completed++;
+      });
+      if(!m_memory_system->send(req)) return false;
+      has_pending = false;
+      outstanding++;
+      issued++;
+      return true;
+    }
+
+  public:
+    void init() override {
+      m_clock_ratio = param<uint>("clock_ratio").required();
+      std::string pattern_name = param<std::string>("pattern").desc("uniform, zipf, sequential, strided or mix.").default_val("uniform");
+      base_block = param<uint64_t>("base_block").desc("First block id of the working set.").default_val(0);
+      working_set = param<uint64_t>("working_set").desc("Number of distinct blocks accessed.").required();
+      float zipf_skew = param<float>("zipf_skew").desc("Exponent of the Zipf distribution.").default_val(0.99);
+      stride = param<uint64_t>("stride").desc("Stride, in blocks, of the strided pattern.").default_val(16);
+      std::vector<float> mix_weights = param<std::vector<float>>("mix_weights").desc("Weights of uniform, zipf, sequential and strided in the mix.").default_val(std::vector<float>{1, 1, 1, 1});
+      read_ratio = param<float>("read_ratio").desc("Fraction of read requests.").default_val(1.0);
+      std::string loop = param<std::string>("loop").desc("closed (fixed outstanding requests) or open (fixed issue rate).").default_val("closed");
+      max_outstanding = param<int>("outstanding").desc("Outstanding requests in closed loop.").default_val(1);
+      rate = param<float>("rate").desc("Requests per frontend cycle in open loop.").default_val(0.01);
+      num_requests = param<size_t>("num_requests").desc("Number of requests to generate.").required();
+      uint64_t seed = param<uint64_t>("seed").desc("Seed of the generator.").default_val(1);
+
+      auto it = std::find(pattern_names.begin(), pattern_names.end(), pattern_name);
+      if(it == pattern_names.end()) throw std::runtime_error(fmt::format("Unknown synthetic pattern \"{}\"", pattern_name));
+      pattern = static_cast<Pattern>(it - pattern_names.begin());
+      if(loop != "closed" && loop != "open") throw std::runtime_error(fmt::format("Unknown synthetic loop \"{}\"", loop));
+      closed_loop = loop == "closed";
+      if(working_set == 0) throw std::runtime_error("The synthetic working set must be positive.");
+      if(mix_weights.size() != 4) throw std::runtime_error(fmt::format("mix_weights needs 4 weights, got {}", mix_weights.size()));
+
+      rng.seed(seed);
+      uniform_block = std::uniform_int_distribution<uint64_t>(0, working_set - 1);
+      zipf_rank = ZipfDistribution(working_set, zipf_skew);
+      mix_pattern = std::discrete_distribution<int>(mix_weights.begin(), mix_weights.end());
+      is_read = std::bernoulli_distribution(read_ratio);
+    };
+
+    void tick() override {
+      if(!closed_loop) issue_credit += rate;
+      while(issued < num_requests) {
+        if(closed_loop ? outstanding >= max_outstanding : issue_credit < 1) return;
+        if(!has_pending) {
+          pending_addr = base_block + next_block(pattern);
+          pending_type = is_read(rng) ? Request::Type::Read : Request::Type::Write;
+          has_pending = true;
+        }
+        if(!send_pending()) return;
+        if(!closed_loop) issue_credit -= 1;
+      }
+    };
+
+    bool is_finished() override {
+      return issued >= num_requests && completed >= issued;
+    };
+};
+
+}   // namespace Ramulator
\ No newline at end of file
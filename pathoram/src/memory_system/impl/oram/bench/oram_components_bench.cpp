@@ -0,0 +1,237 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "memory_system/impl/oram/oob/oob_tree.h"
+#include "memory_system/impl/oram/components/inc/oram_tree_info.h"
+#include "memory_system/impl/oram/components/inc/address_logic_double_tree.h"
+#include "memory_system/impl/oram/components/inc/stash.h"
+#include "memory_system/impl/oram/components/inc/position_map.h"
+
+/**
+ * Micro-benchmarks of the ORAM components in isolation: random leaves, path generation
+ * (AddressLogicDoubleTree and OOBTree), Stash and PositionMap. Each benchmark reports the host time and the heap
+ * allocations per operation.
+ *
+ * Usage: pathoram_bench [scale]  (scale multiplies the number of operations, default 1)
+ */
+
+// Heap allocations are counted by replacing the global operator new
+static size_t num_allocations = 0;
+
+void* operator new(size_t size) {
+    num_allocations++;
+    if (void* ptr = std::malloc(size)) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+
+namespace Ramulator {
+
+class BenchTimer {
+    private:
+        std::chrono::steady_clock::time_point start;
+        size_t start_allocations;
+
+    public:
+        BenchTimer() : start(std::chrono::steady_clock::now()), start_allocations(num_allocations) { }
+
+        void report(const std::string& name, size_t ops) {
+            double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            size_t allocations = num_allocations - start_allocations;
+            std::printf("%-48s %12zu ops %12.1f ns/op %10.2f allocs/op\n", name.c_str(), ops, ns / ops, (double)allocations / ops);
+        }
+};
+
+// Consumes the results (and is stored to a volatile by main) so that the benchmarked calls are not dropped
+static int64_t sink = 0;
+
+/**
+ * @brief Random leaves of a tree with 2^levels leaves, one at a time and in bulk.
+ */
+void bench_leaves(int levels, size_t num_leaves) {
+    int block_size = 64;
+    Addr_t num_buckets = ((Addr_t)1 << levels) - 1;
+    ORAMTreeInfo oram_tree_info(0, num_buckets * block_size * 5, block_size, 4, 2);
+    oram_tree_info.seed_rng(42, 0);
+    std::string config = fmt::format("levels={}", oram_tree_info.levels);
+
+    BenchTimer single_timer;
+    for (size_t i = 0; i < num_leaves; i++) sink += oram_tree_info.get_random_leaf();
+    single_timer.report("leaves/get_random_leaf " + config, num_leaves);
+
+    std::vector<int> leaves(num_leaves);
+    BenchTimer bulk_timer;
+    oram_tree_info.get_random_leaves(leaves.data(), num_leaves);
+    bulk_timer.report("leaves/get_random_leaves " + config, num_leaves);
+    for (int leaf : leaves) sink += leaf;
+}
+
+/**
+ * @brief Path generation: reads all the headers and data blocks of a random path, then writes
+ * back dummy blocks along it, as the ORAM Controller does for an access.
+ */
+void bench_paths(int arity, int levels, int z_blocks, size_t num_paths) {
+    int block_size = 64;
+    Addr_t num_buckets = (Addr_t)std::pow(arity, levels) - 1;
+    Addr_t length_tree = num_buckets * block_size * (z_blocks + 1);
+    ORAMTreeInfo oram_tree_info(0, length_tree, block_size, z_blocks, arity);
+    OOBTree oob_tree;
+    AddressLogicDoubleTree address_logic(&oob_tree);
+    address_logic.attach_oram_info(&oram_tree_info);
+
+    std::string config = fmt::format("arity={} levels={} z={}", arity, oram_tree_info.levels, z_blocks);
+    std::vector<int> leaves(num_paths);
+    oram_tree_info.get_random_leaves(leaves.data(), num_paths);
+
+    BenchTimer init_timer;
+    for (int leaf : leaves) address_logic.init_path(leaf);
+    init_timer.report("path/init_path " + config, num_paths);
+
+    BenchTimer read_timer;
+    size_t reads = 0;
+    for (int leaf : leaves) {
+        for (Addr_t addr = address_logic.generate_next_hdr_address(leaf); addr != -1; addr = address_logic.generate_next_hdr_address(leaf)) {
+            sink += addr;
+            reads++;
+        }
+        for (Addr_t addr = address_logic.generate_next_address(leaf); addr != -1; addr = address_logic.generate_next_address(leaf)) {
+            sink += addr;
+            reads++;
+        }
+    }
+    read_timer.report("path/read_addresses " + config, reads);
+
+    BenchTimer write_timer;
+    size_t writes = 0;
+    for (int leaf : leaves) {
+        for (int level = oram_tree_info.tree_depth; level >= 0; level--) {
+            while (true) {
+                Addr_t addr = address_logic.writeback_dummy(leaf, level);
+                writes++;
+                if (addr < 0) break;
+                sink += addr;
+            }
+        }
+    }
+    write_timer.report("path/writeback_dummy " + config, writes);
+
+    BenchTimer common_timer;
+    size_t checks = 0;
+    for (size_t i = 1; i < leaves.size(); i++) {
+        for (int level = 0; level <= oram_tree_info.tree_depth; level++) {
+            sink += address_logic.is_common_bucket(leaves[i - 1], leaves[i], level);
+            checks++;
+        }
+    }
+    common_timer.report("path/is_common_bucket " + config, checks);
+}
+
+/**
+ * @brief Stash: steady-state add/remove around `size` entries, then eviction scans over the whole stash.
+ */
+void bench_stash(int size, size_t num_ops) {
+    std::mt19937_64 rng(42);
+    Stash stash(size * 2);
+    std::vector<Addr_t> ids;
+    for (int i = 0; i < size; i++) {
+        stash.add_entry(BlockHeader(i, rng() % 1024));
+        ids.push_back(i);
+    }
+    std::string config = fmt::format("size={}", size);
+
+    BenchTimer churn_timer;
+    Addr_t next_id = size;
+    for (size_t i = 0; i < num_ops; i++) {
+        size_t victim = rng() % ids.size();
+        stash.remove_entry(ids[victim]);
+        ids[victim] = next_id;
+        stash.add_entry(BlockHeader(next_id++, rng() % 1024));
+    }
+    churn_timer.report("stash/add_remove " + config, num_ops * 2);
+
+    BenchTimer lookup_timer;
+    for (size_t i = 0; i < num_ops; i++) {
+        sink += stash.is_present(ids[rng() % ids.size()]);
+        sink += stash.get_leaf(ids[rng() % ids.size()]);
+    }
+    lookup_timer.report("stash/lookup " + config, num_ops * 2);
+
+    BenchTimer scan_timer;
+    size_t scanned = 0;
+    while (scanned < num_ops) {
+        stash.reset();
+        for (BlockHeader header = stash.next(); header.block_id != -1; header = stash.next()) {
+            sink += header.leaf;
+            scanned++;
+        }
+    }
+    scan_timer.report("stash/evict_scan " + config, scanned);
+}
+
+/**
+ * @brief PositionMap: lookups and remaps over a dense key space (consecutive block ids) and
+ * a sparse one (block ids spread over a 2^40 address space).
+ */
+void bench_position_map(size_t num_entries, bool sparse, size_t num_ops) {
+    std::mt19937_64 rng(42);
+    PositionMap position_map;
+    std::vector<Addr_t> ids(num_entries);
+    for (size_t i = 0; i < num_entries; i++) {
+        ids[i] = sparse ? (Addr_t)(rng() & ((1ull << 40) - 1)) & ~63ll : (Addr_t)i * 64;
+    }
+    std::string config = fmt::format("entries={} {}", num_entries, sparse ? "sparse" : "dense");
+
+    BenchTimer insert_timer;
+    for (auto id : ids) position_map.add_entry(id, rng() % 1024);
+    insert_timer.report("position_map/add_entry " + config, num_entries);
+
+    BenchTimer lookup_timer;
+    for (size_t i = 0; i < num_ops; i++) {
+        Addr_t id = ids[rng() % num_entries];
+        if (position_map.is_present(id)) sink += position_map.get_leaf(id);
+    }
+    lookup_timer.report("position_map/lookup " + config, num_ops);
+
+    BenchTimer miss_timer;
+    for (size_t i = 0; i < num_ops; i++) {
+        sink += position_map.is_present((Addr_t)(rng() | (1ull << 41)));
+    }
+    miss_timer.report("position_map/lookup_miss " + config, num_ops);
+
+    BenchTimer remap_timer;
+    for (size_t i = 0; i < num_ops; i++) {
+        position_map.remap(ids[rng() % num_entries], rng() % 1024);
+    }
+    remap_timer.report("position_map/remap " + config, num_ops);
+}
+
+}   // namespace Ramulator
+
+int main(int argc, char** argv) {
+    using namespace Ramulator;
+    size_t scale = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1;
+
+    bench_leaves(20, 10000000 * scale);
+    const int path_configs[][2] = {{2, 12}, {2, 20}, {4, 6}, {4, 10}, {8, 4}, {8, 7}};
+    for (auto& config : path_configs) {
+        bench_paths(config[0], config[1], 4, 20000 * scale);
+    }
+    for (int size : {64, 512, 4096}) {
+        bench_stash(size, 200000 * scale);
+    }
+    for (size_t entries : {10000, 1000000}) {
+        bench_position_map(entries, false, 1000000 * scale);
+        bench_position_map(entries, true, 1000000 * scale);
+    }
+    volatile int64_t result = sink;
+    (void)result;
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+#include "memory_system/impl/oram/components/inc/counter_cache.h"
+
+namespace Ramulator {
+
+CounterCache::CounterCache(std::string mode_name, int cache_size, int num_ways) : num_ways(num_ways), minor_counter_bits(7) {
+    if(mode_name == "Monolithic") {
+        mode = Mode::Monolithic;
+    } else if(mode_name == "Split") {
+        mode = Mode::Split;
+    } else {
+        throw std::runtime_error(fmt::format("Unsupported counter mode \"{}\"", mode_name));
+    }
+    num_sets = std::max(1, cache_size / (ORAMTreeInfo::counter_line_size * num_ways));
+    sets.resize(num_sets, std::vector<CacheLine>(num_ways));
+}
+
+int CounterCache::blocks_per_line(std::string mode_name) {
+    if(mode_name == "Monolithic") return ORAMTreeInfo::counter_line_size / sizeof(uint64_t);
+    if(mode_name == "Split") return 64;
+    return 0;
+}
+
+CounterCache::CacheLine* CounterCache::find_line(Addr_t counter_addr) {
+    Addr_t line_index = counter_addr / ORAMTreeInfo::counter_line_size;
+    for(auto& line : sets[line_index % num_sets]) {
+        if(line.tag == line_index) return &line;
+    }
+    return nullptr;
+}
+
+bool CounterCache::lookup(Addr_t counter_addr) {
+    PATHORAM_PROFILE_SCOPE(CounterCache);
+    CacheLine* line = find_line(counter_addr);
+    if(line != nullptr) {
+        line->last_access = ++access_tick;
+        hits++;
+    } else {
+        misses++;
+    }
+    hit_rate = hits / (float)(hits + misses);
+    return line != nullptr;
+}
+
+Addr_t CounterCache::fill(Addr_t counter_addr) {
+    PATHORAM_PROFILE_SCOPE(CounterCache);
+    Addr_t line_index = counter_addr / ORAMTreeInfo::counter_line_size;
+    std::vector<CacheLine>& set = sets[line_index % num_sets];
+    CacheLine* victim = &set.front();
+    for(auto& line : set) {
+        if(line.tag == -1) {
+            victim = &line;
+            break;
+        }
+        if(line.last_access < victim->last_access) {
+            victim = &line;
+        }
+    }
+
+    Addr_t victim_addr = -1;
+    if(victim->tag != -1 && victim->dirty) {
+        victim_addr = victim->tag * ORAMTreeInfo::counter_line_size;
+        dirty_evictions++;
+    }
+    victim->tag = line_index;
+    victim->dirty = false;
+    victim->last_access = ++access_tick;
+    return victim_addr;
+}
+
+bool CounterCache::increment(Addr_t block_addr) {
+    PATHORAM_PROFILE_SCOPE(CounterCache);
+    CacheLine* line = find_line(oram_tree_info->get_counter_address(block_addr));
+    if(line != nullptr) {
+        line->dirty = true;
+    }
+    if(mode == Mode::Monolithic) return false;
+
+    // Split counters: on overflow the major counter is incremented and the minors are reset
+    Addr_t block_index = (block_addr - oram_tree_info->base_address_tree) / oram_tree_info->block_size;
+    int& minor = minor_counters[block_index];
+    minor++;
+    if(minor < (1 << minor_counter_bits)) return false;
+
+    Addr_t first_block = block_index - (block_index % oram_tree_info->counter_blocks_per_line);
+    for(int i = 0; i < oram_tree_info->counter_blocks_per_line; i++) {
+        minor_counters.erase(first_block + i);
+    }
+    minor_overflows++;
+    return true;
+}
+
+void CounterCache::attach_oram_info(const ORAMTreeInfo* oram_tree_info) {
+    this->oram_tree_info = oram_tree_info;
+}
+
+void CounterCache::set_counters(std::map<std::string, size_t&>& counters) {
+    counters.insert({"counter_cache_hits", hits});
+    counters.insert({"counter_cache_misses", misses});
+    counters.insert({"counter_cache_dirty_evictions", dirty_evictions});
+    counters.insert({"counter_cache_minor_overflows", minor_overflows});
+}
+
+void CounterCache::set_metrics(std::map<std::string, float&>& metrics) {
+    metrics.insert({"counter_cache_hit_rate", hit_rate});
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,80 @@
+#include "memory_system/impl/oram/components/inc/functional_oram.h"
+
+namespace Ramulator {
+
+FunctionalORAM::FunctionalORAM(const ORAMTreeInfo& oram_tree_info, int stash_size, int bucket_stats_period) :
+    oram_tree_info(oram_tree_info), address_logic(&oob_tree), stash(stash_size), bucket_stats_period(bucket_stats_period) {
+    address_logic.attach_oram_info(&this->oram_tree_info);
+    if(bucket_stats_period > 0) {
+        oob_tree.attach_oram_info(&this->oram_tree_info);
+    }
+    level_writeback_failures.assign(this->oram_tree_info.levels, 0);
+}
+
+void FunctionalORAM::access_path(Addr_t block_id, const ORAMTreeInfo* oram_tree_info, IPositionMap* position_map, IStash* stash,
+                                 IAddressLogic* address_logic, OOBTree& oob_tree, std::vector<size_t>* writeback_failures) {
+    int leaf = position_map->get_leaf(block_id);
+
+    // Read the path: its real blocks move from the tree to the stash
+    for(Addr_t addr = address_logic->generate_next_address(leaf); addr != -1; addr = address_logic->generate_next_address(leaf)) {
+        BlockHeader block_header = oob_tree.pop(oram_tree_info->get_bucket_index(addr), oram_tree_info->get_block_offset(addr));
+        if(!block_header.is_dummy()) stash->add_entry(block_header);
+    }
+
+    // Remap, as the reply does
+    int new_leaf = oram_tree_info->get_random_leaf();
+    position_map->remap(block_id, new_leaf);
+    stash->remap(block_id, new_leaf);
+    address_logic->init_path(new_leaf);
+
+    // Evict with the same scan of the stash as the writing phase (dummy writebacks leave the tree unchanged)
+    int evict_level = oram_tree_info->tree_depth;
+    stash->reset();
+    for(BlockHeader entry = stash->next(); entry.block_id != -1; entry = stash->next()) {
+        if(!address_logic->is_common_bucket(leaf, entry.leaf, evict_level)) continue;
+        if(address_logic->writeback_data(entry.leaf, evict_level, entry.block_id) != -1) {
+            stash->remove_entry(entry.block_id);
+        } else if(writeback_failures != nullptr) {
+            (*writeback_failures)[evict_level]++;
+        }
+    }
+    stash->reset();
+}
+
+void FunctionalORAM::access(Addr_t block_id) {
+    if(!position_map.is_present(block_id)) {
+        int leaf = oram_tree_info.get_random_leaf();
+        position_map.add_entry(block_id, leaf);
+        address_logic.init_path(leaf);
+        if(!address_logic.init_block(block_id, leaf)) {
+            throw std::runtime_error(fmt::format("Cannot place block {} on the path of leaf {}", block_id, leaf));
+        }
+    }
+    access_path(block_id, &oram_tree_info, &position_map, &stash, &address_logic, oob_tree, &level_writeback_failures);
+
+    if(bucket_stats_period > 0 && accesses % bucket_stats_period == 0) {
+        oob_tree.sample_level_occupancy();
+    }
+    stash_statistics.record(&stash);
+    accesses++;
+}
+
+void FunctionalORAM::refresh_stats() {
+    stash_statistics.refresh(&stash);
+}
+
+void FunctionalORAM::set_counters(std::map<std::string, size_t&>& counters) {
+    counters.insert({"functional_accesses", accesses});
+    stash_statistics.set_counters(counters, "oram_controller_stash");
+    for(size_t level = 0; level < level_writeback_failures.size(); level++) {
+        counters.insert({fmt::format("oram_controller_level{}_writeback_failures", level), level_writeback_failures[level]});
+    }
+    oob_tree.set_counters(counters);
+}
+
+void FunctionalORAM::set_metrics(std::map<std::string, float&>& metrics) {
+    stash_statistics.set_metrics(metrics, "oram_controller_stash");
+    oob_tree.set_metrics(metrics);
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,98 @@
+#include <cmath>
+
+#include "memory_system/impl/oram/components/inc/sampled_simulation.h"
+
+namespace Ramulator {
+
+SampledSimulation::SampledSimulation(size_t period, size_t length, size_t warmup) : period(period), length(length), warmup(warmup) {
+    if(period > 0 && (length == 0 || warmup + length > period)) {
+        throw std::runtime_error(fmt::format("Invalid sampling: the warm-up ({}) and the length ({}) of a sample must fit in its period ({}).", warmup, length, period));
+    }
+}
+
+bool SampledSimulation::on_detailed_request() {
+    bool starts = unit_requests == warmup;
+    unit_requests++;
+    detailed_requests++;
+    if(unit_requests == warmup + length) {
+        mode = Mode::Draining;
+    }
+    return starts;
+}
+
+void SampledSimulation::begin_measurement(Clk_t clk, size_t replies, size_t latency) {
+    start_clk = clk;
+    start_replies = replies;
+    start_latency = latency;
+}
+
+void SampledSimulation::end_sample(Clk_t clk, size_t replies, size_t latency) {
+    size_t served = replies - start_replies;
+    if(served > 0) {
+        sample_cycles_per_request.push_back((double)(clk - start_clk) / served);
+        sample_latency.push_back((double)(latency - start_latency) / served);
+        num_samples++;
+        update_estimates();
+    }
+    if(unit_requests == period) {
+        unit_requests = 0;
+        mode = Mode::Detailed;
+    } else {
+        mode = Mode::FastForward;
+    }
+}
+
+void SampledSimulation::on_fast_forward_request() {
+    fast_forward_requests++;
+    unit_requests++;
+    if(unit_requests == period) {
+        unit_requests = 0;
+        mode = Mode::Detailed;
+    }
+}
+
+double SampledSimulation::confidence_interval(const std::vector<double>& samples, double& mean) {
+    // Two-sided 95% quantiles of the Student t for 1..30 degrees of freedom, then the normal one
+    static const double t95[30] = {12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                                   2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                                   2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+    size_t n = samples.size();
+    mean = 0;
+    for(double x : samples) mean += x;
+    mean /= n;
+    if(n < 2) return 0;
+    double variance = 0;
+    for(double x : samples) variance += (x - mean) * (x - mean);
+    variance /= n - 1;
+    double t = n - 1 <= 30 ? t95[n - 2] : 1.960;
+    return t * std::sqrt(variance / n);
+}
+
+void SampledSimulation::update_estimates() {
+    double mean;
+    cycles_per_request_ci95 = confidence_interval(sample_cycles_per_request, mean);
+    cycles_per_request = mean;
+    avg_latency_ci95 = confidence_interval(sample_latency, mean);
+    avg_latency = mean;
+
+    size_t total_requests = detailed_requests + fast_forward_requests;
+    estimated_cycles = total_requests * cycles_per_request;
+    estimated_cycles_ci95 = total_requests * cycles_per_request_ci95;
+}
+
+void SampledSimulation::set_counters(std::map<std::string, size_t&>& counters) {
+    counters.insert({"sampling_samples", num_samples});
+    counters.insert({"sampling_detailed_requests", detailed_requests});
+    counters.insert({"sampling_fast_forward_requests", fast_forward_requests});
+}
+
+void SampledSimulation::set_metrics(std::map<std::string, float&>& metrics) {
+    metrics.insert({"sampling_cycles_per_request", cycles_per_request});
+    metrics.insert({"sampling_cycles_per_request_ci95", cycles_per_request_ci95});
+    metrics.insert({"sampling_avg_latency", avg_latency});
+    metrics.insert({"sampling_avg_latency_ci95", avg_latency_ci95});
+    metrics.insert({"sampling_estimated_cycles", estimated_cycles});
+    metrics.insert({"sampling_estimated_cycles_ci95", estimated_cycles_ci95});
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+#include <stdexcept>
+
+#include "memory_system/impl/oram/components/inc/source_arbiter.h"
+
+namespace Ramulator {
+
+SourceArbiter::SourceArbiter(const std::string& policy, int num_sources, std::vector<int> weights) {
+    if(policy == "OldestFirst") {
+        this->policy = Policy::OldestFirst;
+    } else if(policy == "RoundRobin") {
+        this->policy = Policy::RoundRobin;
+    } else if(policy == "Weighted") {
+        this->policy = Policy::Weighted;
+    } else {
+        throw std::runtime_error(fmt::format("Unknown arbitration policy {} (OldestFirst, RoundRobin, Weighted)", policy));
+    }
+
+    if(weights.empty()) {
+        weights.assign(num_sources, 1);
+    }
+    if((int)weights.size() != num_sources) {
+        throw std::runtime_error(fmt::format("{} source weights given for {} sources", weights.size(), num_sources));
+    }
+    for(int weight : weights) {
+        if(weight <= 0) throw std::runtime_error(fmt::format("Source weights must be positive, got {}", weight));
+    }
+    this->weights = weights;
+    credits.assign(num_sources, 0);
+}
+
+int SourceArbiter::select(const std::vector<Clk_t>& head_arrivals) {
+    int num_sources = head_arrivals.size();
+    int selected = -1;
+
+    switch(policy) {
+        case Policy::OldestFirst:
+            for(int s = 0; s < num_sources; s++) {
+                if(head_arrivals[s] == empty) continue;
+                if(selected == -1 || head_arrivals[s] < head_arrivals[selected]) selected = s;
+            }
+            break;
+
+        case Policy::RoundRobin:
+            for(int i = 1; i <= num_sources; i++) {
+                int s = (last_source + i) % num_sources;
+                if(head_arrivals[s] != empty) {
+                    selected = s;
+                    break;
+                }
+            }
+            break;
+
+        case Policy::Weighted: {
+            // Every backlogged source earns its weight, the richest one is served and pays the total
+            long total = 0;
+            for(int s = 0; s < num_sources; s++) {
+                if(head_arrivals[s] == empty) continue;
+                credits[s] += weights[s];
+                total += weights[s];
+                if(selected == -1 || credits[s] > credits[selected]) selected = s;
+            }
+            if(selected != -1) credits[selected] -= total;
+            break;
+        }
+    }
+
+    if(selected != -1) last_source = selected;
+    return selected;
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,106 @@
+#include <algorithm>
+#include <cmath>
+
+#include "memory_system/impl/oram/components/inc/stash_statistics.h"
+
+namespace Ramulator {
+
+void StashStatistics::set_targets(std::vector<int> candidate_sizes, std::vector<int> lambdas) {
+    this->candidate_sizes = candidate_sizes;
+    overflow_log2_prob.assign(candidate_sizes.size(), 0);
+    overflow_lambdas = lambdas;
+    size_for_lambda.assign(lambdas.size(), 0);
+}
+
+void StashStatistics::record(IStash* stash) {
+    stash->record_occupancy();
+    size_t occupancy = stash->size();
+    evictions++;
+    occupancy_sum += occupancy;
+    occupancy_max = std::max(occupancy_max, occupancy);
+    occupancy_mean = occupancy_sum / (float)evictions;
+}
+
+void StashStatistics::reset() {
+    evictions = 0;
+    occupancy_sum = 0;
+    occupancy_max = 0;
+    occupancy_p50 = 0;
+    occupancy_p99 = 0;
+    occupancy_p999 = 0;
+    occupancy_p9999 = 0;
+    occupancy_mean = 0;
+    tail_decay = 0;
+    tail_intercept = 0;
+    std::fill(overflow_log2_prob.begin(), overflow_log2_prob.end(), 0);
+    std::fill(size_for_lambda.begin(), size_for_lambda.end(), 0);
+}
+
+void StashStatistics::refresh(IStash* stash) {
+    // tail[r]: evictions that left more than r entries
+    const std::vector<size_t>& distribution = stash->get_occupancy_distribution();
+    std::vector<size_t> tail(occupancy_max + 1, 0);
+    size_t above = evictions;
+    for(size_t r = 0; r <= occupancy_max; r++) {
+        above -= distribution[r];
+        tail[r] = above;
+    }
+    auto percentile = [&](double p) {
+        size_t r = 0;
+        while(r < occupancy_max && tail[r] > (1.0 - p) * evictions) r++;
+        return r;
+    };
+    occupancy_p50 = percentile(0.5);
+    occupancy_p99 = percentile(0.99);
+    occupancy_p999 = percentile(0.999);
+    occupancy_p9999 = percentile(0.9999);
+
+    // Least squares fit of ln P(occupancy > r) over the tail (from the median on), keeping
+    // only the points with enough samples to be meaningful
+    double n = 0, sum_x = 0, sum_y = 0, sum_xx = 0, sum_xy = 0;
+    for(size_t r = occupancy_p50; r <= occupancy_max && tail[r] >= min_tail_samples; r++) {
+        double y = std::log(tail[r] / (double)evictions);
+        n++;
+        sum_x += r;
+        sum_y += y;
+        sum_xx += (double)r * r;
+        sum_xy += r * y;
+    }
+    double denominator = n * sum_xx - sum_x * sum_x;
+    if(n < 2 || denominator <= 0) return;
+    double slope = (n * sum_xy - sum_x * sum_y) / denominator;
+    if(slope >= 0) return;
+    tail_decay = -slope;
+    tail_intercept = (sum_y - slope * sum_x) / n;
+
+    for(size_t i = 0; i < candidate_sizes.size(); i++) {
+        double log_prob = tail_intercept - tail_decay * candidate_sizes[i];
+        overflow_log2_prob[i] = std::min(0.0, log_prob / std::log(2.0));
+    }
+    for(size_t i = 0; i < overflow_lambdas.size(); i++) {
+        size_for_lambda[i] = std::ceil((tail_intercept + overflow_lambdas[i] * std::log(2.0)) / tail_decay);
+    }
+}
+
+void StashStatistics::set_counters(std::map<std::string, size_t&>& counters, const std::string& prefix) {
+    counters.insert({prefix + "_evictions", evictions});
+    counters.insert({prefix + "_occupancy_max", occupancy_max});
+    counters.insert({prefix + "_occupancy_p50", occupancy_p50});
+    counters.insert({prefix + "_occupancy_p99", occupancy_p99});
+    counters.insert({prefix + "_occupancy_p999", occupancy_p999});
+    counters.insert({prefix + "_occupancy_p9999", occupancy_p9999});
+}
+
+void StashStatistics::set_metrics(std::map<std::string, float&>& metrics, const std::string& prefix) {
+    metrics.insert({prefix + "_occupancy_mean", occupancy_mean});
+    metrics.insert({prefix + "_tail_decay", tail_decay});
+    metrics.insert({prefix + "_tail_intercept", tail_intercept});
+    for(size_t i = 0; i < candidate_sizes.size(); i++) {
+        metrics.insert({fmt::format("{}_overflow_log2_prob_size{}", prefix, candidate_sizes[i]), overflow_log2_prob[i]});
+    }
+    for(size_t i = 0; i < overflow_lambdas.size(); i++) {
+        metrics.insert({fmt::format("{}_size_for_lambda{}", prefix, overflow_lambdas[i]), size_for_lambda[i]});
+    }
+}
+
+}
\ No newline at end of file
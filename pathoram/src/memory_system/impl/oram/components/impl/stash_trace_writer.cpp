@@ -0,0 +1,93 @@
+#include "memory_system/impl/oram/components/inc/stash_trace_writer.h"
+
+namespace Ramulator {
+
+StashTraceWriter::~StashTraceWriter() {
+    close();
+}
+
+void StashTraceWriter::put_varint(uint64_t value) {
+    while(value >= 0x80) {
+        buffer.push_back((value & 0x7F) | 0x80);
+        value >>= 7;
+    }
+    buffer.push_back(value);
+}
+
+void StashTraceWriter::flush_buffer() {
+    if(buffer.empty()) return;
+    if(async) {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending_chunks.push_back(std::move(buffer));
+        cv.notify_one();
+    } else {
+        file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+    }
+    buffer.clear();
+    buffer.reserve(chunk_size);
+}
+
+void StashTraceWriter::writer_loop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while(true) {
+        cv.wait(lock, [this] { return stop || !pending_chunks.empty(); });
+        std::vector<std::vector<uint8_t>> chunks;
+        chunks.swap(pending_chunks);
+        lock.unlock();
+        for(auto& chunk : chunks) {
+            file.write(reinterpret_cast<const char*>(chunk.data()), chunk.size());
+        }
+        lock.lock();
+        if(stop && pending_chunks.empty()) return;
+    }
+}
+
+void StashTraceWriter::open(std::string filename, std::string config, int sampling, bool async) {
+    this->sampling = sampling;
+    this->async = async;
+    if(sampling <= 0) return;
+
+    file.open(filename, std::ios::binary | std::ios::trunc);
+    if(!file.is_open()) throw std::runtime_error(fmt::format("Cannot open the stash trace file {}", filename));
+
+    uint32_t config_length = config.size();
+    file.write("STSH", 4);
+    file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    file.write(reinterpret_cast<const char*>(&config_length), sizeof(config_length));
+    file.write(config.data(), config_length);
+
+    buffer.reserve(chunk_size);
+    if(async) {
+        writer_thread = std::thread(&StashTraceWriter::writer_loop, this);
+    }
+}
+
+void StashTraceWriter::record(Clk_t clk, int64_t stash_entries) {
+    if(sampling <= 0 || (num_events++ % sampling) != 0) return;
+
+    int64_t delta_entries = stash_entries - last_entries;
+    put_varint(clk - last_clk);
+    put_varint((uint64_t(delta_entries) << 1) ^ uint64_t(delta_entries >> 63));
+    last_clk = clk;
+    last_entries = stash_entries;
+
+    if(buffer.size() >= chunk_size) {
+        flush_buffer();
+    }
+}
+
+void StashTraceWriter::close() {
+    if(!file.is_open()) return;
+    flush_buffer();
+    if(writer_thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        cv.notify_one();
+        writer_thread.join();
+    }
+    file.close();
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+#include "memory_system/impl/oram/components/inc/timeline_tracer.h"
+
+namespace Ramulator {
+
+TimelineTracer::TimelineTracer(std::string filename, Clk_t window_start, Clk_t window_end, int sampling) :
+    window_start(window_start), window_end(window_end), sampling(std::max(1, sampling)) {
+    file.open(filename, std::ios::trunc);
+    if(!file.is_open()) throw std::runtime_error(fmt::format("Cannot open the timeline trace file {}", filename));
+    file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+}
+
+TimelineTracer::~TimelineTracer() {
+    file << "\n]}\n";
+    file.close();
+}
+
+void TimelineTracer::write_event(const std::string& event) {
+    if(!first_event) {
+        file << ",\n";
+    }
+    first_event = false;
+    file << event;
+}
+
+bool TimelineTracer::sample_transaction(Clk_t clk) {
+    if(!in_window(clk)) return false;
+    return (num_transactions++ % sampling) == 0;
+}
+
+void TimelineTracer::name_track(int pid, int tid, const std::string& name) {
+    if(!named_tracks.insert({pid, tid}).second) return;
+    if(named_tracks.insert({pid, -1}).second) {
+        write_event(fmt::format("{{\"ph\":\"M\",\"name\":\"process_name\",\"pid\":{},\"args\":{{\"name\":\"ORAM partition {}\"}}}}", pid, pid));
+    }
+    write_event(fmt::format("{{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":{},\"tid\":{},\"args\":{{\"name\":\"{}\"}}}}", pid, tid, name));
+    write_event(fmt::format("{{\"ph\":\"M\",\"name\":\"thread_sort_index\",\"pid\":{},\"tid\":{},\"args\":{{\"sort_index\":{}}}}}", pid, tid, tid));
+}
+
+void TimelineTracer::complete(int pid, int tid, const std::string& name, Clk_t start, Clk_t end, const std::string& args) {
+    if(!in_window(start)) return;
+    write_event(fmt::format("{{\"ph\":\"X\",\"name\":\"{}\",\"pid\":{},\"tid\":{},\"ts\":{},\"dur\":{},\"args\":{{{}}}}}", name, pid, tid, start, end - start, args));
+}
+
+void TimelineTracer::instant(int pid, int tid, const std::string& name, Clk_t clk, const std::string& args) {
+    if(!in_window(clk)) return;
+    write_event(fmt::format("{{\"ph\":\"i\",\"s\":\"t\",\"name\":\"{}\",\"pid\":{},\"tid\":{},\"ts\":{},\"args\":{{{}}}}}", name, pid, tid, clk, args));
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,108 @@
+#ifndef COUNTER_CACHE_H
+#define COUNTER_CACHE_H
+
+#include <vector>
+#include <unordered_map>
+
+#include "base/base.h"
+
+#include "memory_system/impl/oram/components/inc/oram_tree_info.h"
+#include "memory_system/impl/oram/components/interfaces/icounter_cache.h"
+#include "memory_system/impl/oram/components/inc/host_profiler.h"
+
+namespace Ramulator {
+
+/**
+ * @class CounterCache
+ * @brief On-chip set-associative cache of the counter-mode encryption counters.
+ *
+ * The counters are stored in DRAM, in a dedicated region at the end of the tree region
+ * (see `ORAMTreeInfo::base_address_counters`). A counter line of `counter_line_size` bytes
+ * holds the counters of `counter_blocks_per_line` consecutive data blocks:
+ * Monolithic: a 64-bit counter per block (8 blocks per line).
+ * Split: a 64-bit major counter shared by 64 blocks, plus a 7-bit minor counter per block.
+ *   When a minor counter overflows, the major counter is incremented and every block of the
+ *   line has to be re-encrypted.
+ *
+ * The cache is write-back and LRU-replaced. Only the tags are modelled, the values of
+ * the minor counters are tracked to detect the overflows.
+ */
+class CounterCache : public ICounterCache {
+
+        enum class Mode {Monolithic, Split};
+
+        struct CacheLine {
+            Addr_t tag = -1;
+            bool dirty = false;
+            uint64_t last_access = 0;
+        };
+
+    private:
+        Mode mode;
+        int num_sets;
+        int num_ways;
+        int minor_counter_bits;
+        const ORAMTreeInfo* oram_tree_info;
+
+        std::vector<std::vector<CacheLine>> sets;
+        uint64_t access_tick = 0;
+
+        // Minor counters of the written blocks (Split mode only)
+        std::unordered_map<Addr_t, int> minor_counters;
+
+        //Counters
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t dirty_evictions = 0;
+        size_t minor_overflows = 0;
+        float hit_rate = 0;
+
+        /**
+         * @brief Returns the line of the cache that holds `counter_addr`, or `nullptr` if it is not cached.
+         */
+        CacheLine* find_line(Addr_t counter_addr);
+
+    public:
+        /**
+         * @brief Constructs the counter cache.
+         * @param mode_name "Monolithic" or "Split".
+         * @param cache_size Capacity of the cache in Bytes.
+         * @param num_ways Associativity of the cache.
+         * @throws if `mode_name` is not a supported counter organization.
+         */
+        CounterCache(std::string mode_name, int cache_size, int num_ways);
+
+        /**
+         * @brief Returns the number of data blocks whose counters share the same line.
+         */
+        static int blocks_per_line(std::string mode_name);
+
+        /**
+         * @brief Looks up the counter line and updates its LRU state.
+         * @return `true` on hit, `false` on miss.
+         */
+        bool lookup(Addr_t counter_addr) override;
+
+        /**
+         * @brief Allocates the counter line in the LRU way of its set.
+         * @return The address of the evicted line if it was dirty (it has to be written back), -1 otherwise.
+         */
+        Addr_t fill(Addr_t counter_addr) override;
+
+        /**
+         * @brief Increments the counter of the block and marks its line dirty.
+         * The counter line must already be cached.
+         * @return `true` if a minor counter overflowed and the whole line has to be re-encrypted.
+         */
+        bool increment(Addr_t block_addr) override;
+
+        void attach_oram_info(const ORAMTreeInfo* oram_tree_info) override;
+
+        void set_counters(std::map<std::string, size_t&>& counters) override;
+
+        void set_metrics(std::map<std::string, float&>& metrics) override;
+};
+
+}
+
+#endif   // COUNTER_CACHE_H
\ No newline at end of file
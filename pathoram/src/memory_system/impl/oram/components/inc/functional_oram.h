@@ -0,0 +1,80 @@
+#ifndef FUNCTIONAL_ORAM_H
+#define FUNCTIONAL_ORAM_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "base/base.h"
+
+#include "memory_system/impl/oram/oob/oob_tree.h"
+#include "memory_system/impl/oram/components/inc/oram_tree_info.h"
+#include "memory_system/impl/oram/components/inc/address_logic_double_tree.h"
+#include "memory_system/impl/oram/components/inc/stash.h"
+#include "memory_system/impl/oram/components/inc/position_map.h"
+#include "memory_system/impl/oram/components/inc/stash_statistics.h"
+
+namespace Ramulator {
+
+/**
+ * @class FunctionalORAM
+ * @brief Untimed PathORAM: the position map, stash, address logic and tree of the timed model,
+ * without DRAM nor controllers. An access reads the path of the block into the stash, remaps the
+ * block and evicts the stash along the path, all in one call.
+ *
+ * It reports the stash and per-level bucket statistics under the same names as the ORAM Controller.
+ */
+class FunctionalORAM {
+
+    private:
+        ORAMTreeInfo oram_tree_info;
+        OOBTree oob_tree;
+        AddressLogicDoubleTree address_logic;
+        Stash stash;
+        PositionMap position_map;
+
+        StashStatistics stash_statistics;
+        std::vector<size_t> level_writeback_failures;
+        int bucket_stats_period;
+        size_t accesses = 0;
+
+    public:
+        /**
+         * @param bucket_stats_period Accesses between two samples of the per-level bucket occupancy (0 disables it).
+         */
+        FunctionalORAM(const ORAMTreeInfo& oram_tree_info, int stash_size, int bucket_stats_period = 64);
+
+        /**
+         * @brief Accesses the path of a mapped block: its real blocks move to the stash, the block is
+         * remapped to a new random leaf and the stash is evicted with the scan of the writing phase.
+         * Shared with `ORAMController::functional_access`.
+         * @param writeback_failures Per-level count of the stash entries that did not fit their bucket (optional).
+         */
+        static void access_path(Addr_t block_id, const ORAMTreeInfo* oram_tree_info, IPositionMap* position_map, IStash* stash,
+                                IAddressLogic* address_logic, OOBTree& oob_tree, std::vector<size_t>* writeback_failures = nullptr);
+
+        /**
+         * @brief Accesses the block, mapping it to a random leaf the first time it is seen.
+         */
+        void access(Addr_t block_id);
+
+        /**
+         * @brief Sets the targets of the stash overflow estimation. Must be called before `set_metrics`.
+         */
+        void set_stash_targets(std::vector<int> candidate_sizes, std::vector<int> lambdas) { stash_statistics.set_targets(candidate_sizes, lambdas); }
+
+        /**
+         * @brief Refreshes the derived statistics (percentiles, tail fit); call it before reading them.
+         */
+        void refresh_stats();
+
+        const ORAMTreeInfo& get_tree_info() const { return oram_tree_info; }
+
+        void set_counters(std::map<std::string, size_t&>& counters);
+
+        void set_metrics(std::map<std::string, float&>& metrics);
+};
+
+}
+
+#endif   // FUNCTIONAL_ORAM_H
\ No newline at end of file
@@ -0,0 +1,91 @@
+#ifndef HOST_PROFILER_H
+#define HOST_PROFILER_H
+
+#include <chrono>
+
+#include "base/base.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// Enabled at build time with the PATHORAM_PROFILE CMake option
+#ifndef PATHORAM_PROFILE
+#define PATHORAM_PROFILE 0
+#endif
+
+namespace Ramulator {
+
+/**
+ * @brief Host-side code regions measured by the profiler.
+ */
+enum class ProfileScope : int {SystemTick, DRAMControllers, ORAMController, IntegrityController,
+                                AddressLogic, Stash, PositionMap, OOBTree, CounterCache};
+
+/**
+ * @class HostProfiler
+ * @brief Low-overhead scoped timers of the simulator wall time, based on the time-stamp counter.
+ * Each scope accumulates its number of calls and its (inclusive) host cycles: nested scopes are
+ * also counted in the enclosing one, e.g. OOBTree inside AddressLogic.
+ *
+ * The timers are compiled only when PATHORAM_PROFILE is 1, otherwise `PATHORAM_PROFILE_SCOPE`
+ * expands to nothing.
+ */
+class HostProfiler {
+    public:
+        static constexpr int num_scopes = 9;
+        static constexpr const char* scope_names[num_scopes] = {"system_tick", "dram_controllers", "oram_controller", "integrity_controller",
+                                                                "address_logic", "stash", "position_map", "oob_tree", "counter_cache"};
+
+        struct Slot {
+            size_t calls = 0;
+            size_t cycles = 0;
+        };
+
+        static Slot& slot(ProfileScope scope) {
+            static Slot slots[num_scopes];
+            return slots[static_cast<int>(scope)];
+        }
+
+        static size_t now() {
+#if defined(__x86_64__) || defined(__i386__)
+            return __rdtsc();
+#else
+            return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+        }
+
+        /**
+         * @brief Host seconds elapsed since the first call.
+         */
+        static float elapsed_seconds() {
+            static const auto start = std::chrono::steady_clock::now();
+            return std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        class ScopedTimer {
+            private:
+                Slot& slot;
+                size_t start;
+
+            public:
+                ScopedTimer(ProfileScope scope) : slot(HostProfiler::slot(scope)), start(HostProfiler::now()) { }
+                ~ScopedTimer() {
+                    slot.calls++;
+                    slot.cycles += HostProfiler::now() - start;
+                }
+        };
+};
+
+}
+
+#if PATHORAM_PROFILE
+#define PATHORAM_PROFILE_CONCAT_(a, b) a##b
+#define PATHORAM_PROFILE_CONCAT(a, b) PATHORAM_PROFILE_CONCAT_(a, b)
+#define PATHORAM_PROFILE_SCOPE(scope) \
+    Ramulator::HostProfiler::ScopedTimer PATHORAM_PROFILE_CONCAT(profile_timer_, __LINE__)(Ramulator::ProfileScope::scope)
+#else
+#define PATHORAM_PROFILE_SCOPE(scope)
+#endif
+
+#endif   // HOST_PROFILER_H
\ No newline at end of file
@@ -0,0 +1,113 @@
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <cmath>
+#include <vector>
+
+#include "base/base.h"
+
+namespace Ramulator {
+
+/**
+ * @class LatencyHistogram
+ * @brief Log-bucketed histogram of latencies (in clock cycles).
+ *
+ * Every power of two is split in `sub_buckets` linear buckets, so the relative error of
+ * a percentile is bounded by 1/`sub_buckets` whatever the magnitude of the latency.
+ * The summary (count, p50, p95, p99 and max) is kept in plain counters that can be
+ * registered as stats; it is updated by `refresh()`.
+ */
+class LatencyHistogram {
+
+    private:
+        static constexpr int sub_bucket_bits = 3;
+        static constexpr int sub_buckets = 1 << sub_bucket_bits;
+        static constexpr int max_bits = 48;
+
+        std::vector<size_t> buckets;
+
+        /**
+         * @brief Maps a latency to the index of its bucket.
+         */
+        static int bucket_index(Clk_t value) {
+            if(value < sub_buckets) return value;
+            int msb = 63 - __builtin_clzll(value);
+            int sub = (value >> (msb - sub_bucket_bits)) & (sub_buckets - 1);
+            return (msb - sub_bucket_bits + 1) * sub_buckets + sub;
+        }
+
+        /**
+         * @brief Returns the upper bound of the latencies that fall in the bucket.
+         */
+        static Clk_t bucket_upper_bound(int index) {
+            if(index < sub_buckets) return index;
+            int msb = index / sub_buckets + sub_bucket_bits - 1;
+            int sub = index % sub_buckets;
+            Clk_t lower = (Clk_t(sub_buckets + sub)) << (msb - sub_bucket_bits);
+            return lower + (Clk_t(1) << (msb - sub_bucket_bits)) - 1;
+        }
+
+    public:
+        size_t count = 0;
+        size_t sum = 0;
+        size_t p50 = 0;
+        size_t p95 = 0;
+        size_t p99 = 0;
+        size_t max = 0;
+
+        LatencyHistogram() : buckets((max_bits - sub_bucket_bits + 1) * sub_buckets, 0) {}
+
+        /**
+         * @brief Adds a sample to the histogram.
+         */
+        void add(Clk_t value) {
+            int index = std::min<int>(bucket_index(value), buckets.size() - 1);
+            buckets[index]++;
+            count++;
+            sum += value;
+            if(value > max) max = value;
+        }
+
+        /**
+         * @brief Updates the summary percentiles in a single pass over the buckets.
+         * A percentile is reported as the upper bound of its bucket (capped to the max).
+         */
+        void refresh() {
+            if(count == 0) return;
+            const double fractions[3] = {0.50, 0.95, 0.99};
+            size_t* percentiles[3] = {&p50, &p95, &p99};
+            int next = 0;
+            size_t cumulative = 0;
+            for(size_t i = 0; i < buckets.size() && next < 3; i++) {
+                cumulative += buckets[i];
+                while(next < 3 && cumulative >= std::max<size_t>(1, std::ceil(fractions[next] * count))) {
+                    *percentiles[next] = std::min<size_t>(bucket_upper_bound(i), max);
+                    next++;
+                }
+            }
+        }
+
+        /**
+         * @brief Drops all the samples.
+         */
+        void reset() {
+            std::fill(buckets.begin(), buckets.end(), 0);
+            count = sum = p50 = p95 = p99 = max = 0;
+        }
+
+        /**
+         * @brief Attach the summary of the histogram to the counters, with names `<prefix>_<stat>`.
+         */
+        void set_counters(std::map<std::string, size_t&>& counters, std::string prefix) {
+            counters.insert({prefix + "_count", count});
+            counters.insert({prefix + "_sum", sum});
+            counters.insert({prefix + "_p50", p50});
+            counters.insert({prefix + "_p95", p95});
+            counters.insert({prefix + "_p99", p99});
+            counters.insert({prefix + "_max", max});
+        }
+};
+
+}
+
+#endif   // LATENCY_HISTOGRAM_H
\ No newline at end of file
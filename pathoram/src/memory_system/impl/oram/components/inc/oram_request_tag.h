@@ -0,0 +1,51 @@
+#ifndef ORAM_REQUEST_TAG_H
+#define ORAM_REQUEST_TAG_H
+
+#include "base/base.h"
+#include "base/request.h"
+
+namespace Ramulator {
+
+/**
+ * @brief Kind of a memory request generated by the ORAM Controller.
+ */
+enum class ORAMRequestKind : int {Unknown = 0, HeaderRead, DataRead, RealWriteback, DummyWriteback, CounterRead, CounterWrite, Reencryption};
+
+/**
+ * @class ORAMRequestTag
+ * @brief Stores the kind and the tree level of an ORAM-generated request in its scratchpad, so that
+ * the components on the DRAM side (tracer, statistics) can tell the requests apart.
+ * The level is stored shifted by one: an empty slot means that the request has no tree level
+ * (counter lines).
+ */
+class ORAMRequestTag {
+    public:
+        static constexpr int num_kinds = 8;
+        static constexpr int kind_slot = 0;
+        static constexpr int level_slot = 1;
+        // Free for the DRAM-side consumers of the tag (e.g. to mark a request as already accounted)
+        static constexpr int user_slot = 2;
+
+        static void set(Request& req, ORAMRequestKind kind, int level = -1) {
+            req.scratchpad[kind_slot] = static_cast<int>(kind);
+            req.scratchpad[level_slot] = level + 1;
+        }
+
+        static int level(const Request& req) {
+            return req.scratchpad[level_slot] - 1;
+        }
+
+        static ORAMRequestKind kind(const Request& req) {
+            return static_cast<ORAMRequestKind>(req.scratchpad[kind_slot]);
+        }
+
+        static const char* name(ORAMRequestKind kind) {
+            static constexpr const char* names[num_kinds] = {"unknown", "header_read", "data_read", "real_writeback",
+                                                             "dummy_writeback", "counter_read", "counter_write", "reencryption"};
+            return names[static_cast<int>(kind)];
+        }
+};
+
+}
+
+#endif   // ORAM_REQUEST_TAG_H
\ No newline at end of file
@@ -1,78 +1,144 @@
-#ifndef ORAM_TREE_INFO_H
-#define ORAM_TREE_INFO_H
-
-#include <random>
-
-#include "base/base.h"
-
-namespace Ramulator {
-
-class ORAMTreeInfo {
-
-    public:
-        mutable std::mt19937 rng;
-        mutable std::uniform_int_distribution<int> leaf_dist;
-
-        //Tree's properties
-        int tree_depth;
-        int levels;
-        int arity;
-        
-        //Tree-Memory properties
-        Addr_t base_address_tree;
-        Addr_t length_tree;
-        int bucket_size;
-        int block_size;
-        int z_blocks;
-
-        ORAMTreeInfo(Addr_t base_address_tree, Addr_t length_tree, int block_size, int z_blocks, int arity) :
-            base_address_tree(base_address_tree), length_tree(length_tree), block_size(block_size),
-            z_blocks(z_blocks), arity(arity) {
-            bucket_size = block_size * z_blocks; 
-            int num_buckets = (z_blocks/(z_blocks + 1.0) * length_tree) / bucket_size;
-            int shift_bits_arity = static_cast<int>(std::log2(arity));
-            int num_buckets2 = num_buckets + 1;
-            tree_depth = 0;
-            while(num_buckets2 >> shift_bits_arity) {
-                tree_depth++;
-                num_buckets2 >>= shift_bits_arity;
-            }
-            levels = tree_depth;
-            tree_depth -= 1;
-            std::random_device rd;
-            rng.seed(rd());
-            leaf_dist = std::uniform_int_distribution<int>(0, (int)pow(arity, tree_depth)-1);
-        }
-
-        /**
-         * @brief Return a random leaf between 0 and max number of leaves.
-         * @details This method returns a random leaf number generated through an uniform distribution between
-         * 0 and the max number of precalculated leaves.
-         */
-        int get_random_leaf() const {
-            return leaf_dist(rng);
-        }
-
-        /**
-         * @brief Maps a memory address to the bucket index
-         * @param addr the memory address to map
-         * @return Returns the mapped `int bucket_index`
-        */
-        int get_bucket_index(Addr_t addr) const {
-            return (addr - base_address_tree) / bucket_size;
-        }
-
-        /**
-         * @brief Maps a memory address to the block offset within a bucket
-         * @param addr the memory address to map
-         * @return Returns the mapped `int block_offset` 0-based. Its range values space from 0 to `z_blocks-1`
-        */
-        int get_block_offset(Addr_t addr) const {
-            int block_offset = (addr - base_address_tree) % (bucket_size);
-            return block_offset / block_size;
-        }
-};
-
-}
-
+#ifndef ORAM_TREE_INFO_H
+#define ORAM_TREE_INFO_H
+
+#include <cmath>
+
+#include "base/base.h"
+
+#include "memory_system/impl/oram/components/inc/random_stream.h"
+
+namespace Ramulator {
+
+class ORAMTreeInfo {
+
+    public:
+        // Random leaves: stream `RandomStream::Leaves` of the partition, reseeded by `seed_rng`
+        uint64_t seed;
+        int partition = 0;
+        mutable RandomStream rng;
+        uint32_t num_leaves;
+
+        //Tree's properties
+        int tree_depth;
+        int levels;
+        int arity;
+        
+        //Tree-Memory properties
+        Addr_t base_address_tree;
+        Addr_t length_tree;
+        int bucket_size;
+        int block_size;
+        int z_blocks;
+
+        //Encryption counters properties
+        static constexpr int counter_line_size = 64;
+        int counter_blocks_per_line;
+        Addr_t base_address_counters;
+
+        ORAMTreeInfo(Addr_t base_address_tree, Addr_t length_tree, int block_size, int z_blocks, int arity, int counter_blocks_per_line = 0) :
+            base_address_tree(base_address_tree), length_tree(length_tree), block_size(block_size),
+            z_blocks(z_blocks), arity(arity), counter_blocks_per_line(counter_blocks_per_line) {
+            bucket_size = block_size * z_blocks; 
+            // The counters' region is carved at the end of the tree region:
+            // every data block needs counter_line_size/counter_blocks_per_line bytes of counter.
+            if(counter_blocks_per_line > 0) {
+                Addr_t bucket_counters_size = z_blocks * (counter_line_size / counter_blocks_per_line);
+                Addr_t counters_length = (length_tree / (bucket_size + block_size + bucket_counters_size)) * bucket_counters_size;
+                counters_length = ((counters_length + counter_line_size - 1) / counter_line_size) * counter_line_size;
+                length_tree -= counters_length;
+                this->length_tree = length_tree;
+            }
+            base_address_counters = base_address_tree + length_tree;
+            int num_buckets = (z_blocks/(z_blocks + 1.0) * length_tree) / bucket_size;
+            int shift_bits_arity = static_cast<int>(std::log2(arity));
+            int num_buckets2 = num_buckets + 1;
+            tree_depth = 0;
+            while(num_buckets2 >> shift_bits_arity) {
+                tree_depth++;
+                num_buckets2 >>= shift_bits_arity;
+            }
+            levels = tree_depth;
+            tree_depth -= 1;
+            num_leaves = (uint32_t)pow(arity, tree_depth);
+            seed_rng(RandomStream::random_seed(), 0);
+        }
+
+        /**
+         * @brief Seeds the random leaves and the streams handed out by `make_rng`.
+         * @param seed Seed of the run: the same seed replays the same leaves bit-exactly.
+         * @param partition Instance of the streams, so that partitions sharing a seed draw independent leaves.
+         */
+        void seed_rng(uint64_t seed, int partition) {
+            this->seed = seed;
+            this->partition = partition;
+            rng = make_rng(RandomStream::Leaves);
+        }
+
+        /**
+         * @brief Returns the stream of `component` for this tree, independent of the others drawn from the same seed.
+         */
+        RandomStream make_rng(RandomStream::Component component) const {
+            return RandomStream(seed, RandomStream::stream_id(component, partition));
+        }
+
+        /**
+         * @brief Return a random leaf between 0 and max number of leaves.
+         * @details This method returns a random leaf number generated through an uniform distribution between
+         * 0 and the max number of precalculated leaves.
+         */
+        int get_random_leaf() const {
+            return rng.uniform(num_leaves);
+        }
+
+        /**
+         * @brief Fills `leaves` with `n` random leaves, the same ones `n` calls to `get_random_leaf` would return.
+         */
+        void get_random_leaves(int* leaves, size_t n) const {
+            rng.fill_uniform(num_leaves, leaves, n);
+        }
+
+        /**
+         * @brief Maps a memory address to the bucket index
+         * @param addr the memory address to map
+         * @return Returns the mapped `int bucket_index`
+        */
+        int get_bucket_index(Addr_t addr) const {
+            return (addr - base_address_tree) / bucket_size;
+        }
+
+        /**
+         * @brief Returns the tree level (0 is the root) of a bucket
+         * @param bucket_index the index of the bucket
+        */
+        int get_level(int bucket_index) const {
+            int level = 0;
+            for(int node = bucket_index + 1; node >= arity; node /= arity) {
+                level++;
+            }
+            return level;
+        }
+
+        /**
+         * @brief Maps a memory address to the block offset within a bucket
+         * @param addr the memory address to map
+         * @return Returns the mapped `int block_offset` 0-based. Its range values space from 0 to `z_blocks-1`
+        */
+        int get_block_offset(Addr_t addr) const {
+            int block_offset = (addr - base_address_tree) % (bucket_size);
+            return block_offset / block_size;
+        }
+
+        /**
+         * @brief Maps a data block address to the address of the counter line that holds its encryption counter.
+         * @param addr the memory address of the data block
+         * @return Returns the `Addr_t` of the counter line in the counters' region.
+        */
+        Addr_t get_counter_address(Addr_t addr) const {
+            Addr_t block_index = (addr - base_address_tree) / block_size;
+            return base_address_counters + (block_index / counter_blocks_per_line) * counter_line_size;
+        }
+};
+
+}
+
 #endif // ORAM_TREE_INFO_H
\ No newline at end of file
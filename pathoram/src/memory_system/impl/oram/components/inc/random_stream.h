@@ -0,0 +1,137 @@
+#ifndef RANDOM_STREAM_H
+#define RANDOM_STREAM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+namespace Ramulator {
+
+/**
+ * @class RandomStream
+ * @brief Counter-based random generator (Philox4x32-10): the i-th output of a stream is a pure
+ * function of (seed, stream, i), so runs are reproducible bit-exactly from the seed and any number
+ * of components or threads can draw from independent streams of the same seed without sharing state.
+ *
+ * The state is 48 bytes (key, stream, counter and the buffered block) and each block of 10 rounds
+ * yields four 32-bit outputs. It satisfies the UniformRandomBitGenerator requirements, so it can
+ * also drive the `<random>` distributions.
+ */
+class RandomStream {
+
+    public:
+        /**
+         * @brief Components drawing from the streams of a seed. The stream of a component is
+         * `stream_id(component, instance)`, the instance being the partition or the thread.
+         */
+        enum Component : uint64_t {
+            Leaves = 0,
+            AddressLogic = 1,
+            Router = 2,
+            Workload = 3,
+        };
+
+        using result_type = uint32_t;
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+        static constexpr uint64_t stream_id(Component component, uint64_t instance) {
+            return (instance << 8) | component;
+        }
+
+        /**
+         * @brief A seed drawn from `std::random_device`, for runs that do not set one.
+         */
+        static uint64_t random_seed() {
+            std::random_device rd;
+            return ((uint64_t)rd() << 32) | rd();
+        }
+
+        RandomStream(uint64_t seed = 0, uint64_t stream = 0) : key{(uint32_t)seed, (uint32_t)(seed >> 32)}, stream(stream) {}
+
+        result_type operator()() {
+            if(buffered == 0) {
+                generate_block(counter++, block);
+                buffered = 4;
+            }
+            return block[4 - buffered--];
+        }
+
+        /**
+         * @brief Returns a uniform integer in [0, range), without bias (Lemire's multiply-shift
+         * with rejection, which almost never rejects).
+         */
+        uint32_t uniform(uint32_t range) {
+            return bounded((*this)(), range);
+        }
+
+        /**
+         * @brief Fills `out` with `n` uniform integers in [0, range), generating whole blocks at once.
+         */
+        void fill_uniform(uint32_t range, int* out, size_t n) {
+            size_t i = 0;
+            while(i < n && buffered > 0) out[i++] = uniform(range);
+            uint32_t values[4];
+            for(; i + 4 <= n; i += 4) {
+                generate_block(counter++, values);
+                for(int j = 0; j < 4; j++) out[i + j] = bounded(values[j], range);
+            }
+            for(; i < n; i++) out[i] = uniform(range);
+        }
+
+    private:
+        static constexpr uint32_t M0 = 0xD2511F53;
+        static constexpr uint32_t M1 = 0xCD9E8D57;
+        static constexpr uint32_t W0 = 0x9E3779B9;
+        static constexpr uint32_t W1 = 0xBB67AE85;
+
+        uint32_t key[2];
+        uint64_t stream;
+        uint64_t counter = 0;
+        uint32_t block[4];
+        int buffered = 0;
+
+        uint32_t bounded(uint32_t x, uint32_t range) {
+            uint64_t m = (uint64_t)x * range;
+            uint32_t low = (uint32_t)m;
+            if(low < range) {
+                uint32_t threshold = -range % range;
+                while(low < threshold) {
+                    m = (uint64_t)(*this)() * range;
+                    low = (uint32_t)m;
+                }
+            }
+            return m >> 32;
+        }
+
+        /**
+         * @brief Philox4x32-10 of the 128-bit counter (position, stream) under the 64-bit key (seed).
+         */
+        void generate_block(uint64_t position, uint32_t out[4]) const {
+            uint32_t c0 = (uint32_t)position, c1 = (uint32_t)(position >> 32);
+            uint32_t c2 = (uint32_t)stream, c3 = (uint32_t)(stream >> 32);
+            uint32_t k0 = key[0], k1 = key[1];
+            for(int round = 0; round < 10; round++) {
+                uint64_t p0 = (uint64_t)M0 * c0;
+                uint64_t p1 = (uint64_t)M1 * c2;
+                uint32_t n0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;
+                uint32_t n2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;
+                c1 = (uint32_t)p1;
+                c3 = (uint32_t)p0;
+                c0 = n0;
+                c2 = n2;
+                k0 += W0;
+                k1 += W1;
+            }
+            out[0] = c0;
+            out[1] = c1;
+            out[2] = c2;
+            out[3] = c3;
+        }
+};
+
+}
+
+#endif   // RANDOM_STREAM_H
\ No newline at end of file
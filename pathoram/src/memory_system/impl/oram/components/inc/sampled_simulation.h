@@ -0,0 +1,112 @@
+#ifndef SAMPLED_SIMULATION_H
+#define SAMPLED_SIMULATION_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "base/base.h"
+
+namespace Ramulator {
+
+/**
+ * @class SampledSimulation
+ * @brief Periodic sampling of the request stream (in the style of SMARTS).
+ *
+ * Every `period` requests form a sampling unit: the first `warmup` requests are simulated in
+ * detail to refill the queues, the next `length` are simulated in detail and measured, then the
+ * memory system drains and the remaining requests are fast-forwarded functionally (position map,
+ * stash and tree only, in zero time).
+ *
+ * A sample measures the cycles per request (cycles from the start of the measurement to the end of
+ * the drain, over the replies served meanwhile) and the average reply latency. The whole run is
+ * extrapolated from the sample means, with the 95% confidence interval of the Student t.
+ */
+class SampledSimulation {
+
+    public:
+        enum class Mode {Detailed, Draining, FastForward};
+
+    private:
+        size_t period = 0;
+        size_t length = 0;
+        size_t warmup = 0;
+
+        Mode mode = Mode::Detailed;
+        size_t unit_requests = 0;
+
+        // Start of the measurement of the current sample
+        Clk_t start_clk = 0;
+        size_t start_replies = 0;
+        size_t start_latency = 0;
+
+        std::vector<double> sample_cycles_per_request;
+        std::vector<double> sample_latency;
+
+        size_t num_samples = 0;
+        size_t detailed_requests = 0;
+        size_t fast_forward_requests = 0;
+        float cycles_per_request = 0;
+        float cycles_per_request_ci95 = 0;
+        float avg_latency = 0;
+        float avg_latency_ci95 = 0;
+        float estimated_cycles = 0;
+        float estimated_cycles_ci95 = 0;
+
+        /**
+         * @brief Half width of the 95% confidence interval of the mean of the samples.
+         */
+        static double confidence_interval(const std::vector<double>& samples, double& mean);
+
+        /**
+         * @brief Refreshes the sample means and the extrapolation to the whole run.
+         */
+        void update_estimates();
+
+    public:
+        /**
+         * @param period Requests in a sampling unit (0 disables the sampling).
+         * @param length Measured requests of each sample.
+         * @param warmup Detailed but unmeasured requests before each measurement.
+         */
+        SampledSimulation(size_t period = 0, size_t length = 0, size_t warmup = 0);
+
+        bool is_enabled() const { return period > 0; }
+
+        Mode get_mode() const { return mode; }
+
+        /**
+         * @brief Accounts a request accepted in detailed mode.
+         * @return `true` if the measurement of the sample starts with this request: the caller
+         * then passes the current totals to `begin_measurement`.
+         */
+        bool on_detailed_request();
+
+        void begin_measurement(Clk_t clk, size_t replies, size_t latency);
+
+        /**
+         * @brief Closes the sample once the memory system has drained, and starts the fast-forward.
+         * @param replies Total replies served so far.
+         * @param latency Total reply latency so far.
+         */
+        void end_sample(Clk_t clk, size_t replies, size_t latency);
+
+        /**
+         * @brief Accounts a fast-forwarded request. The next sampling unit starts in detailed mode.
+         */
+        void on_fast_forward_request();
+
+        /**
+         * @brief Refreshes the estimates at the end of the run, so that they count the requests
+         * fast-forwarded after the last sample.
+         */
+        void refresh() { update_estimates(); }
+
+        void set_counters(std::map<std::string, size_t&>& counters);
+
+        void set_metrics(std::map<std::string, float&>& metrics);
+};
+
+}
+
+#endif   // SAMPLED_SIMULATION_H
\ No newline at end of file
@@ -0,0 +1,55 @@
+#ifndef SOURCE_ARBITER_H
+#define SOURCE_ARBITER_H
+
+#include <string>
+#include <vector>
+
+#include "base/base.h"
+
+namespace Ramulator {
+
+/**
+ * @class SourceArbiter
+ * @brief Chooses the request source (core) whose oldest pending transaction the ORAM Controller
+ * executes next, so that a memory-intensive source cannot starve the others.
+ *
+ * Policies:
+ * - OldestFirst: the head transaction that arrived first (a single global FIFO, the default).
+ * - RoundRobin: the sources with pending transactions take turns.
+ * - Weighted: smooth weighted round-robin, source i gets weights[i] of every sum(weights) accesses
+ *   while all of them have pending transactions.
+ */
+class SourceArbiter {
+
+    public:
+        enum class Policy {OldestFirst, RoundRobin, Weighted};
+
+        // Arrival of the head transaction of a source without pending transactions
+        static constexpr Clk_t empty = -1;
+
+    private:
+        Policy policy = Policy::OldestFirst;
+        std::vector<int> weights;
+        std::vector<long> credits;
+        int last_source = -1;
+
+    public:
+        SourceArbiter() = default;
+
+        /**
+         * @param policy "OldestFirst", "RoundRobin" or "Weighted".
+         * @param weights Weighted policy: one positive weight per source (empty for equal weights).
+         */
+        SourceArbiter(const std::string& policy, int num_sources, std::vector<int> weights);
+
+        /**
+         * @brief Selects the source served next.
+         * @param head_arrivals Arrival cycle of the head transaction of each source, `empty` if it has none.
+         * @return The index of the selected source, -1 if no source has pending transactions.
+         */
+        int select(const std::vector<Clk_t>& head_arrivals);
+};
+
+}
+
+#endif   // SOURCE_ARBITER_H
\ No newline at end of file
@@ -0,0 +1,76 @@
+#ifndef STASH_STATISTICS_H
+#define STASH_STATISTICS_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "base/base.h"
+#include "memory_system/impl/oram/components/interfaces/istash.h"
+
+namespace Ramulator {
+
+/**
+ * @class StashStatistics
+ * @brief Stash occupancy after each eviction, its percentiles and the exponential fit of its tail:
+ * P(occupancy > R) ~ exp(tail_intercept - tail_decay * R), from which the overflow probability of
+ * candidate stash sizes and the stash size needed for a security parameter are extrapolated.
+ *
+ * Shared by the timed ORAM Controller and the functional ORAM engine, so that both report the
+ * same statistics.
+ */
+class StashStatistics {
+
+    private:
+        static constexpr size_t min_tail_samples = 10;
+
+    public:
+        size_t evictions = 0;
+        size_t occupancy_sum = 0;
+        size_t occupancy_max = 0;
+        size_t occupancy_p50 = 0;
+        size_t occupancy_p99 = 0;
+        size_t occupancy_p999 = 0;
+        size_t occupancy_p9999 = 0;
+        float occupancy_mean = 0;
+        float tail_decay = 0;
+        float tail_intercept = 0;
+        std::vector<int> candidate_sizes;
+        std::vector<float> overflow_log2_prob;
+        std::vector<int> overflow_lambdas;
+        std::vector<float> size_for_lambda;
+
+        /**
+         * @brief Sets the targets of the overflow estimation. Must be called before `set_metrics`.
+         * @param candidate_sizes Stash sizes whose overflow probability (log2) is extrapolated.
+         * @param lambdas Security parameters: the stash size giving a 2^-lambda overflow probability is extrapolated.
+         */
+        void set_targets(std::vector<int> candidate_sizes, std::vector<int> lambdas);
+
+        /**
+         * @brief Records the occupancy of the stash at the end of an eviction.
+         */
+        void record(IStash* stash);
+
+        /**
+         * @brief Clears the statistics and the tail fit (the occupancy distribution is held by the stash).
+         */
+        void reset();
+
+        /**
+         * @brief Refreshes the percentiles and the tail fit from the occupancy distribution of the stash.
+         * The cost is linear in the maximum occupancy.
+         */
+        void refresh(IStash* stash);
+
+        /**
+         * @brief Attach the statistics to the counters and metrics, with names `<prefix>_<stat>`.
+         */
+        void set_counters(std::map<std::string, size_t&>& counters, const std::string& prefix);
+
+        void set_metrics(std::map<std::string, float&>& metrics, const std::string& prefix);
+};
+
+}
+
+#endif   // STASH_STATISTICS_H
\ No newline at end of file
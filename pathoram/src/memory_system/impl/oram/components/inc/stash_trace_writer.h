@@ -0,0 +1,85 @@
+#ifndef STASH_TRACE_WRITER_H
+#define STASH_TRACE_WRITER_H
+
+#include <fstream>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "base/base.h"
+
+namespace Ramulator {
+
+/**
+ * @class StashTraceWriter
+ * @brief Buffered writer of the stash occupancy trace.
+ *
+ * The trace is a compact binary stream:
+ * Header: the magic "STSH", a u32 version, a u32 length and the configuration string
+ *   (`key=value` pairs separated by `;`, it includes the `stash_size`).
+ * Records: one per sampled transaction, as the LEB128 varint of the clock delta from the
+ *   previous record followed by the zigzag varint of the delta of the stash entries.
+ *
+ * Records are accumulated in memory and written in large chunks; optionally the chunks are
+ * written by a background thread so that the simulation never waits on the file system.
+ * Use `convert_stash_trace.py` to convert the trace to the CSV format read by `stash_plots.py`.
+ */
+class StashTraceWriter {
+
+    private:
+        static constexpr uint32_t version = 1;
+        static constexpr size_t chunk_size = 1 << 16;
+
+        std::ofstream file;
+        int sampling = 0;
+        bool async = false;
+        size_t num_events = 0;
+
+        Clk_t last_clk = 0;
+        int64_t last_entries = 0;
+        std::vector<uint8_t> buffer;
+
+        // Background writer
+        std::thread writer_thread;
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::vector<std::vector<uint8_t>> pending_chunks;
+        bool stop = false;
+
+        void put_varint(uint64_t value);
+
+        /**
+         * @brief Hands the current buffer over to the file (or to the background writer).
+         */
+        void flush_buffer();
+
+        void writer_loop();
+
+    public:
+        StashTraceWriter() = default;
+        ~StashTraceWriter();
+
+        /**
+         * @brief Opens (truncating) the trace file and writes the header.
+         * @param filename The trace file.
+         * @param config The configuration string stored in the header.
+         * @param sampling A record is written every `sampling` transactions. 0 disables the trace.
+         * @param async Write the chunks from a background thread.
+         */
+        void open(std::string filename, std::string config, int sampling, bool async);
+
+        /**
+         * @brief Records the stash size at the start of a transaction, if sampled.
+         */
+        void record(Clk_t clk, int64_t stash_entries);
+
+        /**
+         * @brief Writes every buffered record and closes the file.
+         */
+        void close();
+};
+
+}
+
+#endif   // STASH_TRACE_WRITER_H
\ No newline at end of file
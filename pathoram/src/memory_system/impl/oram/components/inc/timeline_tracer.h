@@ -0,0 +1,74 @@
+#ifndef TIMELINE_TRACER_H
+#define TIMELINE_TRACER_H
+
+#include <fstream>
+#include <set>
+
+#include "base/base.h"
+
+namespace Ramulator {
+
+/**
+ * @class TimelineTracer
+ * @brief Exports the ORAM activity as a Chrome trace-event JSON file
+ * (to be opened with chrome://tracing or https://ui.perfetto.dev).
+ *
+ * Each ORAM partition is a process with the following tracks (threads):
+ * `oram_fsm_track`: the phases of the ORAM transactions.
+ * `integrity_fsm_track`: the states of the Integrity Controller.
+ * `channel_track(c)`: the DRAM requests sent to channel `c` (reads as slices, writes as instants).
+ * Timestamps are expressed in memory clock cycles.
+ *
+ * Only the events inside the [`window_start`, `window_end`] cycle window are written, and
+ * only one transaction every `sampling` is traced (see `sample_transaction`).
+ */
+class TimelineTracer {
+
+    private:
+        std::ofstream file;
+        bool first_event = true;
+        Clk_t window_start = 0;
+        Clk_t window_end = 0;
+        int sampling = 1;
+        size_t num_transactions = 0;
+        std::set<std::pair<int, int>> named_tracks;
+
+        void write_event(const std::string& event);
+
+    public:
+        static constexpr int oram_fsm_track = 0;
+        static constexpr int integrity_fsm_track = 1;
+        static int channel_track(int channel_id) { return 100 + channel_id; }
+
+        TimelineTracer(std::string filename, Clk_t window_start, Clk_t window_end, int sampling);
+        ~TimelineTracer();
+
+        /**
+         * @brief Returns `true` if the cycle falls in the traced window.
+         */
+        bool in_window(Clk_t clk) const { return clk >= window_start && clk <= window_end; }
+
+        /**
+         * @brief Called when a transaction starts: decides whether its events are traced.
+         */
+        bool sample_transaction(Clk_t clk);
+
+        /**
+         * @brief Names a track the first time it is used.
+         */
+        void name_track(int pid, int tid, const std::string& name);
+
+        /**
+         * @brief Writes a slice [start, end] on a track. `args` is a (possibly empty) JSON object body.
+         */
+        void complete(int pid, int tid, const std::string& name, Clk_t start, Clk_t end, const std::string& args = "");
+
+        /**
+         * @brief Writes an instant event on a track.
+         */
+        void instant(int pid, int tid, const std::string& name, Clk_t clk, const std::string& args = "");
+};
+
+}
+
+#endif   // TIMELINE_TRACER_H
\ No newline at end of file
@@ -0,0 +1,139 @@
+#ifndef TRANSACTION_TABLE_H
+#define TRANSACTION_TABLE_H
+
+#include <deque>
+#include <optional>
+#include <vector>
+
+namespace Ramulator {
+
+/**
+ * @class TransactionTable
+ * @brief Table of the ORAM transactions, like the MSHRs of a cache: a pool of pre-allocated
+ * fixed-size entries, each one either free, waiting in the FIFO queue of its source or in service.
+ *
+ * The queues are linked lists of entry indexes threaded through the pool, so allocating,
+ * queueing and releasing an entry never allocates memory. An entry keeps its address from
+ * `allocate` to `release`, so it can be referenced while it is in service.
+ * With a capacity of 0 the table is unbounded: the pool grows when all the entries are in use.
+ */
+template<typename Entry>
+class TransactionTable {
+
+    private:
+        struct Slot {
+            std::optional<Entry> entry;
+            int next = -1;
+        };
+
+        // std::deque keeps the address of the entries when the unbounded pool grows
+        std::deque<Slot> slots;
+        int free_head = -1;
+        std::vector<int> heads;
+        std::vector<int> tails;
+        size_t capacity = 0;
+        size_t used = 0;
+        size_t queued = 0;
+
+        void add_free_slots(size_t count) {
+            size_t first = slots.size();
+            slots.resize(first + count);
+            for(size_t i = first + count; i-- > first;) {
+                slots[i].next = free_head;
+                free_head = i;
+            }
+        }
+
+    public:
+        /**
+         * @param num_queues Number of FIFO queues (sources).
+         * @param capacity Number of entries, pre-allocated (0 for an unbounded table).
+         */
+        TransactionTable(int num_queues = 1, size_t capacity = 0) : heads(num_queues, -1), tails(num_queues, -1), capacity(capacity) {
+            add_free_slots(capacity > 0 ? capacity : 64);
+        }
+
+        bool is_full() const { return capacity > 0 && used == capacity; }
+
+        /**
+         * @brief Entries in use, waiting or in service.
+         */
+        size_t size() const { return used; }
+
+        /**
+         * @brief Entries waiting in the queues.
+         */
+        size_t num_queued() const { return queued; }
+
+        int num_queues() const { return heads.size(); }
+
+        bool is_queue_empty(int queue) const { return heads[queue] == -1; }
+
+        /**
+         * @brief Allocates an entry without queueing it (it is directly in service).
+         * @return The index of the entry, -1 if the table is full.
+         */
+        int allocate(Entry entry) {
+            if(is_full()) return -1;
+            if(free_head == -1) add_free_slots(slots.size());
+            int index = free_head;
+            free_head = slots[index].next;
+            slots[index].entry.emplace(std::move(entry));
+            slots[index].next = -1;
+            used++;
+            return index;
+        }
+
+        /**
+         * @brief Allocates an entry at the back of the queue.
+         * @return The index of the entry, -1 if the table is full.
+         */
+        int push(int queue, Entry entry) {
+            int index = allocate(std::move(entry));
+            if(index == -1) return -1;
+            if(tails[queue] == -1) {
+                heads[queue] = index;
+            } else {
+                slots[tails[queue]].next = index;
+            }
+            tails[queue] = index;
+            queued++;
+            return index;
+        }
+
+        /**
+         * @brief Returns the index of the entry at the front of the queue, -1 if it is empty.
+         */
+        int front(int queue) const { return heads[queue]; }
+
+        /**
+         * @brief Removes the front entry from its queue: it stays allocated, in service, until `release`.
+         * @return The index of the entry.
+         */
+        int dequeue(int queue) {
+            int index = heads[queue];
+            heads[queue] = slots[index].next;
+            if(heads[queue] == -1) tails[queue] = -1;
+            slots[index].next = -1;
+            queued--;
+            return index;
+        }
+
+        Entry& at(int index) { return *slots[index].entry; }
+
+        const Entry& at(int index) const { return *slots[index].entry; }
+
+        /**
+         * @brief Frees an entry in service.
+         */
+        void release(int index) {
+            slots[index].entry.reset();
+            slots[index].next = free_head;
+            free_head = index;
+            used--;
+        }
+};
+
+}
+
+#endif   // TRANSACTION_TABLE_H
\ No newline at end of file
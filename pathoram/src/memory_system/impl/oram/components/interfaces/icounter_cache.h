@@ -0,0 +1,57 @@
+#ifndef I_COUNTER_CACHE_H
+#define I_COUNTER_CACHE_H
+
+#include "base/base.h"
+
+#include "memory_system/impl/oram/components/inc/oram_tree_info.h"
+
+namespace Ramulator {
+
+/**
+ * @class ICounterCache
+ * @brief Interface for the on-chip cache of the encryption counters
+ */
+class ICounterCache {
+
+    public:
+        ICounterCache() {};
+        virtual ~ICounterCache() {};
+
+        /**
+         * @brief Looks up the counter line in the cache.
+         * @param counter_addr The address of the counter line.
+         */
+        virtual bool lookup(Addr_t counter_addr) = 0;
+
+        /**
+         * @brief Allocates the counter line in the cache, evicting a victim if needed.
+         * @param counter_addr The address of the counter line.
+         */
+        virtual Addr_t fill(Addr_t counter_addr) = 0;
+
+        /**
+         * @brief Increments the encryption counter of a data block being written back.
+         * @param block_addr The address of the data block.
+         */
+        virtual bool increment(Addr_t block_addr) = 0;
+
+        /**
+         * @brief Dependency Injection of the object that holds information about
+         * the ORAM Tree. 
+         */
+        virtual void attach_oram_info(const ORAMTreeInfo* oram_tree_info) = 0;
+
+        /**
+         * @brief Set the Counter Cache's counters.
+         */
+        virtual void set_counters(std::map<std::string, size_t&>& counters) = 0;
+
+        /**
+         * @brief Set the Counter Cache's derived metrics (e.g. hit rate).
+         */
+        virtual void set_metrics(std::map<std::string, float&>& metrics) = 0;
+};
+
+}
+
+#endif // I_COUNTER_CACHE_H
\ No newline at end of file
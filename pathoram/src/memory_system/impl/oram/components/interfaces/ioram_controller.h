@@ -1,47 +1,104 @@
-#ifndef I_ORAM_CONTROLLER_H
-#define I_ORAM_CONTROLLER_H
-
-#include "memory_system/impl/oram/components/inc/oram_tree_info.h"
-#include "memory_system/impl/oram/components/interfaces/iintegrity_controller.h"
-
-namespace Ramulator {
-
-/**
- * @class IORAMController
- * @brief Interface for ORAM Controller class
- */
-class IORAMController {
-
-    public:
-        IORAMController() {};
-        virtual ~IORAMController() {};
-
-        /**
-         * @brief Send to ORAM Controller a new memory Request.
-         */
-        virtual bool send(Request req) = 0;
-
-        /**
-         * @brief Connect the Integrity Controller.
-         */
-        virtual void connect_integrity_controller(IIntegrityController* integrity_controller) = 0;
-
-        /**
-         * @brief Set the integrity check for the requested block.
-         */
-        virtual void integrity_check(Addr_t addr) = 0;
-        
-        /**
-         * @brief Attach the ORAM Tree Info to ORAM Controller with Dependency Injection.
-         */
-        virtual void attach_oram_info(const ORAMTreeInfo* oram_tree_info) = 0;
-
-        /**
-         * @brief Set the ORAM Controller's counters.
-         */
-        virtual void set_counters(std::map<std::string, size_t&>& counters) = 0;
-};
-
-}
-
+#ifndef I_ORAM_CONTROLLER_H
+#define I_ORAM_CONTROLLER_H
+
+#include "memory_system/impl/oram/components/inc/oram_tree_info.h"
+#include "memory_system/impl/oram/components/inc/timeline_tracer.h"
+#include "memory_system/impl/oram/components/interfaces/iintegrity_controller.h"
+#include "memory_system/impl/oram/components/interfaces/icounter_cache.h"
+
+namespace Ramulator {
+
+/**
+ * @class IORAMController
+ * @brief Interface for ORAM Controller class
+ */
+class IORAMController {
+
+    public:
+        IORAMController() {};
+        virtual ~IORAMController() {};
+
+        /**
+         * @brief Send to ORAM Controller a new memory Request.
+         */
+        virtual bool send(Request req) = 0;
+
+        /**
+         * @brief Performs the ORAM access of the block functionally, in zero time and without DRAM
+         * traffic: only the position map, the stash and the tree are updated. Used to fast-forward
+         * between the samples of a sampled simulation, while the controller is idle.
+         */
+        virtual void functional_access(Addr_t block_id) = 0;
+
+        /**
+         * @brief Returns `true` if no transaction is in flight and no request waits to be sent.
+         */
+        virtual bool is_idle() = 0;
+
+        /**
+         * @brief Connect the Integrity Controller.
+         */
+        virtual void connect_integrity_controller(IIntegrityController* integrity_controller) = 0;
+
+        /**
+         * @brief Set the integrity check for the requested block.
+         */
+        virtual void integrity_check(Addr_t addr) = 0;
+
+        /**
+         * @brief Removes a block held in the stash from this ORAM, to migrate it to another partition.
+         */
+        virtual bool migrate_out(Addr_t block_id) = 0;
+
+        /**
+         * @brief Checks whether the stash can take a migrated block.
+         */
+        virtual bool can_migrate_in() = 0;
+
+        /**
+         * @brief Adds a block migrated from another partition to the stash, on a random leaf.
+         * The caller checks `can_migrate_in` first.
+         */
+        virtual void migrate_in(Addr_t block_id) = 0;
+        
+        /**
+         * @brief Attach the ORAM Tree Info to ORAM Controller with Dependency Injection.
+         */
+        virtual void attach_oram_info(const ORAMTreeInfo* oram_tree_info) = 0;
+
+        /**
+         * @brief Attach the Counter Cache to ORAM Controller with Dependency Injection.
+         * Without a Counter Cache the encryption counters are not modelled.
+         */
+        virtual void attach_counter_cache(ICounterCache* counter_cache) = 0;
+
+        /**
+         * @brief Attach the timeline tracer. `pid` identifies the ORAM partition in the trace.
+         */
+        virtual void attach_tracer(TimelineTracer* tracer, int pid) = 0;
+
+        /**
+         * @brief Set the ORAM Controller's counters.
+         */
+        virtual void set_counters(std::map<std::string, size_t&>& counters) = 0;
+
+        /**
+         * @brief Set the ORAM Controller's derived metrics.
+         */
+        virtual void set_metrics(std::map<std::string, float&>& metrics) = 0;
+
+        /**
+         * @brief Drops the internal state behind the statistics (histograms, distributions) at the
+         * end of the warm-up. The registered counters are cleared by the memory system.
+         */
+        virtual void reset_stats() = 0;
+
+        /**
+         * @brief Returns the current number of entries in the stash.
+         */
+        virtual int get_stash_size() = 0;
+};
+
+}
+
 #endif // I_ORAM_CONTROLLER_H
\ No newline at end of file
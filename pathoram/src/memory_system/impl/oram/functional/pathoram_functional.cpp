@@ -0,0 +1,140 @@
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "memory_system/impl/oram/components/inc/functional_oram.h"
+#include "memory_system/impl/oram/components/inc/random_stream.h"
+
+/**
+ * Untimed PathORAM runs for stash-overflow and bucket-occupancy studies: each run drives an
+ * independent FunctionalORAM with uniformly random block ids, the runs execute in parallel on
+ * `threads` cores. The statistics of each run are printed with the names of the timed model.
+ * Run r draws its leaves and block ids from the streams of instance r of `seed`, so a run is
+ * replayed bit-exactly whatever the number of threads.
+ *
+ * Usage: pathoram_functional [key=value ...]
+ *   length_tree, block_size, z_blocks, arity, stash_size   tree configuration (as in the YAML)
+ *   accesses       accesses per seed (default 10^7)
+ *   working_set    distinct blocks accessed (default: half of the block slots of the tree)
+ *   seed           seed of the runs (default 1)
+ *   seeds          number of independent runs (default 1)
+ *   threads        worker threads (default: the hardware concurrency)
+ *   bucket_stats_period   accesses between two bucket occupancy samples (default 64)
+ */
+
+namespace Ramulator {
+
+struct FunctionalConfig {
+    Addr_t length_tree = 2147483648;
+    int block_size = 512;
+    int z_blocks = 4;
+    int arity = 2;
+    int stash_size = 8192;
+    size_t accesses = 10000000;
+    size_t working_set = 0;
+    uint64_t seed = 1;
+    int seeds = 1;
+    int threads = 0;
+    int bucket_stats_period = 64;
+};
+
+FunctionalConfig parse_args(int argc, char** argv) {
+    FunctionalConfig config;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        size_t eq = arg.find('=');
+        if (eq == std::string::npos) throw std::runtime_error("Expected key=value, got " + arg);
+        std::string key = arg.substr(0, eq);
+        // strtod accepts the scientific notation, e.g. accesses=1e9
+        double value = std::strtod(arg.c_str() + eq + 1, nullptr);
+        if (key == "length_tree") config.length_tree = (Addr_t)value;
+        else if (key == "block_size") config.block_size = (int)value;
+        else if (key == "z_blocks") config.z_blocks = (int)value;
+        else if (key == "arity") config.arity = (int)value;
+        else if (key == "stash_size") config.stash_size = (int)value;
+        else if (key == "accesses") config.accesses = (size_t)value;
+        else if (key == "working_set") config.working_set = (size_t)value;
+        else if (key == "seed") config.seed = std::stoull(arg.substr(eq + 1));
+        else if (key == "seeds") config.seeds = (int)value;
+        else if (key == "threads") config.threads = (int)value;
+        else if (key == "bucket_stats_period") config.bucket_stats_period = (int)value;
+        else throw std::runtime_error("Unknown parameter " + key);
+    }
+    if (config.threads <= 0) config.threads = std::max(1u, std::thread::hardware_concurrency());
+    return config;
+}
+
+/**
+ * @brief Executes one run and returns its report.
+ */
+std::string run(const FunctionalConfig& config, int run_index) {
+    ORAMTreeInfo oram_tree_info(0, config.length_tree, config.block_size, config.z_blocks, config.arity);
+    oram_tree_info.seed_rng(config.seed, run_index);
+    FunctionalORAM oram(oram_tree_info, config.stash_size, config.bucket_stats_period);
+    oram.set_stash_targets({32, 64, 128, 256}, {20, 40, 80, 128});
+
+    size_t working_set = config.working_set;
+    if (working_set == 0) {
+        size_t num_buckets = (size_t)std::pow(config.arity, oram_tree_info.levels) - 1;
+        working_set = num_buckets * config.z_blocks / 2;
+    }
+    RandomStream rng = oram_tree_info.make_rng(RandomStream::Workload);
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < config.accesses; i++) {
+        oram.access(rng.uniform(working_set));
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    oram.refresh_stats();
+
+    std::map<std::string, size_t&> counters;
+    std::map<std::string, float&> metrics;
+    oram.set_counters(counters);
+    oram.set_metrics(metrics);
+    std::string report = fmt::format("run{}:\n  seed: {}\n  levels: {}\n  working_set: {}\n  accesses_per_second: {:.0f}\n",
+                                     run_index, config.seed, oram_tree_info.levels, working_set, config.accesses / seconds);
+    for (auto& e : counters) report += fmt::format("  {}: {}\n", e.first, e.second);
+    for (auto& e : metrics) report += fmt::format("  {}: {}\n", e.first, e.second);
+    return report;
+}
+
+}   // namespace Ramulator
+
+int main(int argc, char** argv) {
+    using namespace Ramulator;
+    FunctionalConfig config;
+    try {
+        config = parse_args(argc, argv);
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "%s\n", e.what());
+        return 1;
+    }
+
+    // Runs are handed out to the workers; reports are printed in run order
+    std::vector<std::string> reports(config.seeds);
+    std::mutex mutex;
+    int next_run = 0;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < std::min(config.threads, config.seeds); t++) {
+        workers.emplace_back([&]() {
+            while (true) {
+                int run_index;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (next_run == config.seeds) return;
+                    run_index = next_run++;
+                }
+                reports[run_index] = run(config, run_index);
+            }
+        });
+    }
+    for (auto& worker : workers) worker.join();
+    for (auto& report : reports) std::fputs(report.c_str(), stdout);
+    return 0;
+}
\ No newline at end of file
@@ -1,169 +1,180 @@
-#ifndef BUCKET_H
-#define BUCKET_H
-
-#include <vector>
-
-#include "base/base.h"
-
-namespace Ramulator {
-
-class OOBTree;
-
-/**
- * @class Block
- * @brief Represents a generic DRAM block.
- * 
- * This is used as base class for Header and Data blocks.
- */
-class Block {
-    public:
-        Block() = default;
-};
-
-/**
- * @class BlockHeader
- * @brief Represents metadata for a block in an ORAM bucket.
- *
- * This structure stores the program address and the corresponding leaf
- * in the ORAM tree where the block is logically mapped.
- */
-class BlockHeader : public Block {
-    public:
-        Addr_t block_id = -1;
-        int leaf = -1;
-
-        BlockHeader() = default;
-
-        /**
-         * @brief Parameterized constructor to create a block header.
-         * @param block_id The block id of the block.
-         * @param leaf The ORAM leaf associated with the block.
-         */
-        BlockHeader(Addr_t block_id, int leaf) : block_id(block_id), leaf(leaf) {}
-
-        bool is_dummy() { return block_id < 0; }
-};
-
-/**
- * @class BlockData
- * @brief Represents the block's data.
- * 
- * This structure stores a data stub block.
- */
-class BlockData : public Block {
-    public:
-        char data;
-
-        BlockData() = default;
-};
-
-/**
- * @class Bucket
- * @brief Represents a physical bucket in the ORAM tree structure.
- *
- * A bucket contains a fixed number of block headers (`z_blocks`) and provides
- * methods for inserting, removing, and querying metadata about the blocks.
- * Each block is represented only by its header (address and leaf).
- */
-class Bucket {
-
-    private:
-        int bucket_id;
-        std::vector<BlockHeader> block_headers;
-        std::vector<BlockData> block_data;  //TODO: Unused. Not useful now.
-    
-        /**
-         * @brief Retrieves a pointer to the block header at the specified offset.
-         * @param offset The index of the block header within the bucket.
-         * @return Pointer to the block header, or `nullptr` if offset is invalid.
-         */
-        BlockHeader get_block_header(int offset) {
-            return block_headers.at(offset);
-        }
-
-        /**
-         * @brief Returns a copy and remove the header of the block at the given `offset`.
-         * @param offset The index of the block header within the bucket.
-         * @return A copy of `BlockHeader`; or throws if the block_header does not exists.
-         */
-        BlockHeader pop_header(int offset) {
-            BlockHeader block_header = block_headers.at(offset);
-            block_headers.at(offset) = BlockHeader();
-            return block_header;
-        }
-
-        /**
-         * @brief Checks whether the block at the given offset in the bucket is a dummy.
-         * @param offset Index of the block in the bucket.
-         * @return `true` if the block is a dummy (invalid), `false` otherwise.
-         */
-        bool is_dummy(int offset) const {
-            return block_headers[offset].block_id < 0;
-        }
-
-        friend class OOBTree;
-
-    public:
-        Bucket() {};
-        /**
-         * @brief Constructs a bucket with space for `z_blocks` default headers.
-         * @param z_blocks The number of slots in the bucket.
-         */
-        Bucket(int z_blocks): block_headers(z_blocks) {};
-
-        /**
-         * @brief Gets the number of block headers in the bucket.
-         * @return Total number of slots (capacity).
-         */
-        int size() const {
-            return static_cast<int>(block_headers.size());
-        }
-
-        /**
-         * @brief Inserts a block header into the specified offset.
-         * @param block_offset Index in the bucket to insert into.
-         * @param block_id The block id of the block.
-         * @param leaf The associated leaf.
-         * @return `true` if the insertion was successful; `false` otherwise.
-         */
-        bool insert_block_header(int block_offset, Addr_t block_id, int leaf) {
-            /*bool success = false;
-            if (block_offset >= 0 && block_offset < static_cast<int>(block_headers.size())) {
-                block_headers[block_offset].block_id = block_id;
-                block_headers[block_offset].leaf = leaf;
-                success = true;
-            }
-            return success;*/
-            block_headers[block_offset].block_id = block_id;
-            block_headers[block_offset].leaf = leaf;
-            return true;
-        }
-
-        /**
-         * @brief Removes a block header at the specified offset.
-         * @param block_offset The index of the block to remove.
-         * @return `true` if the block was removed; `false` if offset is invalid.
-         */
-        bool remove_block_header(int block_offset) {
-            bool success = false;
-            if (block_offset >= 0 && block_offset < static_cast<int>(block_headers.size())) {
-                block_headers[block_offset] = BlockHeader();
-                success = true;
-            }
-            return success;
-        }
-
-        /**
-         * @brief Prints the contents of the bucket.
-         */
-        void dump() const {
-            for (size_t i = 0; i < block_headers.size(); ++i) {
-                const auto& hdr = block_headers[i];
-                std::cout<<" ["<< i<<"] block_id: "<< hdr.block_id <<", leaf: "<< hdr.leaf << std::endl;
-            }
-        }
-};
-
-}
-
+#ifndef BUCKET_H
+#define BUCKET_H
+
+#include <vector>
+
+#include "base/base.h"
+
+namespace Ramulator {
+
+class OOBTree;
+
+/**
+ * @class Block
+ * @brief Represents a generic DRAM block.
+ * 
+ * This is used as base class for Header and Data blocks.
+ */
+class Block {
+    public:
+        Block() = default;
+};
+
+/**
+ * @class BlockHeader
+ * @brief Represents metadata for a block in an ORAM bucket.
+ *
+ * This structure stores the program address and the corresponding leaf
+ * in the ORAM tree where the block is logically mapped.
+ */
+class BlockHeader : public Block {
+    public:
+        Addr_t block_id = -1;
+        int leaf = -1;
+
+        BlockHeader() = default;
+
+        /**
+         * @brief Parameterized constructor to create a block header.
+         * @param block_id The block id of the block.
+         * @param leaf The ORAM leaf associated with the block.
+         */
+        BlockHeader(Addr_t block_id, int leaf) : block_id(block_id), leaf(leaf) {}
+
+        bool is_dummy() { return block_id < 0; }
+};
+
+/**
+ * @class BlockData
+ * @brief Represents the block's data.
+ * 
+ * This structure stores a data stub block.
+ */
+class BlockData : public Block {
+    public:
+        char data;
+
+        BlockData() = default;
+};
+
+/**
+ * @class Bucket
+ * @brief Represents a physical bucket in the ORAM tree structure.
+ *
+ * A bucket contains a fixed number of block headers (`z_blocks`) and provides
+ * methods for inserting, removing, and querying metadata about the blocks.
+ * Each block is represented only by its header (address and leaf).
+ */
+class Bucket {
+
+    private:
+        int bucket_id;
+        std::vector<BlockHeader> block_headers;
+        std::vector<BlockData> block_data;  //TODO: Unused. Not useful now.
+    
+        /**
+         * @brief Retrieves a pointer to the block header at the specified offset.
+         * @param offset The index of the block header within the bucket.
+         * @return Pointer to the block header, or `nullptr` if offset is invalid.
+         */
+        BlockHeader get_block_header(int offset) {
+            return block_headers.at(offset);
+        }
+
+        /**
+         * @brief Returns a copy and remove the header of the block at the given `offset`.
+         * @param offset The index of the block header within the bucket.
+         * @return A copy of `BlockHeader`; or throws if the block_header does not exists.
+         */
+        BlockHeader pop_header(int offset) {
+            BlockHeader block_header = block_headers.at(offset);
+            block_headers.at(offset) = BlockHeader();
+            return block_header;
+        }
+
+        /**
+         * @brief Checks whether the block at the given offset in the bucket is a dummy.
+         * @param offset Index of the block in the bucket.
+         * @return `true` if the block is a dummy (invalid), `false` otherwise.
+         */
+        bool is_dummy(int offset) const {
+            return block_headers[offset].block_id < 0;
+        }
+
+        friend class OOBTree;
+
+    public:
+        Bucket() {};
+        /**
+         * @brief Constructs a bucket with space for `z_blocks` default headers.
+         * @param z_blocks The number of slots in the bucket.
+         */
+        Bucket(int z_blocks): block_headers(z_blocks) {};
+
+        /**
+         * @brief Gets the number of block headers in the bucket.
+         * @return Total number of slots (capacity).
+         */
+        int size() const {
+            return static_cast<int>(block_headers.size());
+        }
+
+        /**
+         * @brief Gets the number of real (non-dummy) blocks in the bucket.
+         */
+        int num_real() const {
+            int real = 0;
+            for(const auto& header : block_headers) {
+                real += header.block_id >= 0;
+            }
+            return real;
+        }
+
+        /**
+         * @brief Inserts a block header into the specified offset.
+         * @param block_offset Index in the bucket to insert into.
+         * @param block_id The block id of the block.
+         * @param leaf The associated leaf.
+         * @return `true` if the insertion was successful; `false` otherwise.
+         */
+        bool insert_block_header(int block_offset, Addr_t block_id, int leaf) {
+            /*bool success = false;
+            if (block_offset >= 0 && block_offset < static_cast<int>(block_headers.size())) {
+                block_headers[block_offset].block_id = block_id;
+                block_headers[block_offset].leaf = leaf;
+                success = true;
+            }
+            return success;*/
+            block_headers[block_offset].block_id = block_id;
+            block_headers[block_offset].leaf = leaf;
+            return true;
+        }
+
+        /**
+         * @brief Removes a block header at the specified offset.
+         * @param block_offset The index of the block to remove.
+         * @return `true` if the block was removed; `false` if offset is invalid.
+         */
+        bool remove_block_header(int block_offset) {
+            bool success = false;
+            if (block_offset >= 0 && block_offset < static_cast<int>(block_headers.size())) {
+                block_headers[block_offset] = BlockHeader();
+                success = true;
+            }
+            return success;
+        }
+
+        /**
+         * @brief Prints the contents of the bucket.
+         */
+        void dump() const {
+            for (size_t i = 0; i < block_headers.size(); ++i) {
+                const auto& hdr = block_headers[i];
+                std::cout<<" ["<< i<<"] block_id: "<< hdr.block_id <<", leaf: "<< hdr.leaf << std::endl;
+            }
+        }
+};
+
+}
+
 #endif  //BUCKET_H
\ No newline at end of file
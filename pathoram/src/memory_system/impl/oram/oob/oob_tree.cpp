@@ -1,44 +1,125 @@
-#include "memory_system/impl/oram/oob/oob_tree.h"
-
-namespace Ramulator {
-
-bool OOBTree::insert_bucket(int bucket_index, const Bucket& bucket) {
-    return buckets.insert({bucket_index, bucket}).second;
-}
-
-bool OOBTree::insert_block_header(int bucket_index, int block_offset, BlockHeader block_header) {
-    auto it = buckets.find(bucket_index);
-    if (it == buckets.end()) return false;
-    it->second.block_headers.at(block_offset).block_id = block_header.block_id;
-    it->second.block_headers.at(block_offset).leaf = block_header.leaf;
-    return true;
-}
-
-bool OOBTree::remove_block_header(int bucket_index, int block_offset) {
-    auto it = buckets.find(bucket_index);
-    if (it == buckets.end()) return false;
-    it->second.block_headers.at(block_offset).block_id = -1;
-    it->second.block_headers.at(block_offset).leaf = -1;
-    return true;
-}
-
-bool OOBTree::is_dummy(int bucket_index, int block_offset) const {
-    auto it = buckets.find(bucket_index);
-    if (it == buckets.end()) throw "Bucket not found";
-    return it->second.is_dummy(block_offset);
-}
-
-BlockHeader OOBTree::pop(int bucket_index, int block_offset) {
-    return buckets.at(bucket_index).pop_header(block_offset);
-}
-
-void OOBTree::dump() const {
-    std::cout << "ORAMTree dump: "<< buckets.size() <<" %zu buckets" << std::endl;
-    for (const auto& [bidx, bucket] : buckets) {
-        std::cout << "Bucket["<< bidx <<"] {" << std::endl;
-        bucket.dump();
-        std::cout << "}" << std::endl;
-    }
-}
-
+#include "memory_system/impl/oram/oob/oob_tree.h"
+
+namespace Ramulator {
+
+bool OOBTree::insert_bucket(int bucket_index, const Bucket& bucket) {
+    PATHORAM_PROFILE_SCOPE(OOBTree);
+    bool inserted = buckets.insert({bucket_index, bucket}).second;
+    if (inserted && oram_tree_info != nullptr) {
+        int level = oram_tree_info->get_level(bucket_index);
+        initialized_buckets[level]++;
+        level_occupancy[level][bucket.num_real()]++;
+    }
+    return inserted;
+}
+
+bool OOBTree::insert_block_header(int bucket_index, int block_offset, BlockHeader block_header) {
+    PATHORAM_PROFILE_SCOPE(OOBTree);
+    auto it = buckets.find(bucket_index);
+    if (it == buckets.end()) return false;
+    int old_real = it->second.num_real();
+    it->second.block_headers.at(block_offset).block_id = block_header.block_id;
+    it->second.block_headers.at(block_offset).leaf = block_header.leaf;
+    update_occupancy(bucket_index, old_real, it->second.num_real());
+    return true;
+}
+
+bool OOBTree::remove_block_header(int bucket_index, int block_offset) {
+    PATHORAM_PROFILE_SCOPE(OOBTree);
+    auto it = buckets.find(bucket_index);
+    if (it == buckets.end()) return false;
+    int old_real = it->second.num_real();
+    it->second.block_headers.at(block_offset).block_id = -1;
+    it->second.block_headers.at(block_offset).leaf = -1;
+    update_occupancy(bucket_index, old_real, it->second.num_real());
+    return true;
+}
+
+bool OOBTree::is_dummy(int bucket_index, int block_offset) const {
+    PATHORAM_PROFILE_SCOPE(OOBTree);
+    auto it = buckets.find(bucket_index);
+    if (it == buckets.end()) throw "Bucket not found";
+    return it->second.is_dummy(block_offset);
+}
+
+BlockHeader OOBTree::pop(int bucket_index, int block_offset) {
+    PATHORAM_PROFILE_SCOPE(OOBTree);
+    Bucket& bucket = buckets.at(bucket_index);
+    int old_real = bucket.num_real();
+    BlockHeader block_header = bucket.pop_header(block_offset);
+    update_occupancy(bucket_index, old_real, bucket.num_real());
+    return block_header;
+}
+
+void OOBTree::update_occupancy(int bucket_index, int old_real, int new_real) {
+    if (oram_tree_info == nullptr || old_real == new_real) return;
+    int level = oram_tree_info->get_level(bucket_index);
+    level_occupancy[level][old_real]--;
+    level_occupancy[level][new_real]++;
+}
+
+void OOBTree::attach_oram_info(const ORAMTreeInfo* oram_tree_info) {
+    this->oram_tree_info = oram_tree_info;
+    int levels = oram_tree_info->levels;
+    int z_blocks = oram_tree_info->z_blocks;
+    level_occupancy.assign(levels, std::vector<size_t>(z_blocks + 1, 0));
+    sampled_occupancy.assign(levels, std::vector<size_t>(z_blocks + 1, 0));
+    initialized_buckets.assign(levels, 0);
+    mean_occupancy.assign(levels, 0);
+    full_fraction.assign(levels, 0);
+}
+
+void OOBTree::sample_level_occupancy() {
+    if (oram_tree_info == nullptr) return;
+    num_samples++;
+    int z_blocks = oram_tree_info->z_blocks;
+    size_t level_buckets = 1;
+    for (int level = 0; level < oram_tree_info->levels; level++) {
+        sampled_occupancy[level][0] += level_buckets - initialized_buckets[level];
+        for (int k = 0; k <= z_blocks; k++) {
+            sampled_occupancy[level][k] += level_occupancy[level][k];
+        }
+        size_t total = 0;
+        size_t real_blocks = 0;
+        for (int k = 0; k <= z_blocks; k++) {
+            total += sampled_occupancy[level][k];
+            real_blocks += k * sampled_occupancy[level][k];
+        }
+        mean_occupancy[level] = real_blocks / (float)total;
+        full_fraction[level] = sampled_occupancy[level][z_blocks] / (float)total;
+        level_buckets *= oram_tree_info->arity;
+    }
+}
+
+void OOBTree::set_counters(std::map<std::string, size_t&>& counters) {
+    for (size_t level = 0; level < sampled_occupancy.size(); level++) {
+        for (size_t k = 0; k < sampled_occupancy[level].size(); k++) {
+            counters.insert({fmt::format("oob_level{}_occupancy{}", level, k), sampled_occupancy[level][k]});
+        }
+    }
+}
+
+void OOBTree::set_metrics(std::map<std::string, float&>& metrics) {
+    for (size_t level = 0; level < mean_occupancy.size(); level++) {
+        metrics.insert({fmt::format("oob_level{}_mean_occupancy", level), mean_occupancy[level]});
+        metrics.insert({fmt::format("oob_level{}_full_fraction", level), full_fraction[level]});
+    }
+}
+
+void OOBTree::reset_stats() {
+    num_samples = 0;
+    for (auto& level : sampled_occupancy) {
+        std::fill(level.begin(), level.end(), 0);
+    }
+}
+
+void OOBTree::dump() const {
+    std::cout << "ORAMTree dump: "<< buckets.size() <<" %zu buckets" << std::endl;
+    for (const auto& [bidx, bucket] : buckets) {
+        std::cout << "Bucket["<< bidx <<"] {" << std::endl;
+        bucket.dump();
+        std::cout << "}" << std::endl;
+    }
+}
+
 }
\ No newline at end of file
@@ -1,291 +1,921 @@
-#include "memory_system/impl/oram/oram_controller.h"
-#include "memory_system/impl/oram/components/inc/address_logic_double_tree.h"
-#include "memory_system/impl/oram/components/inc/stash.h"
-#include "memory_system/impl/oram/components/inc/position_map.h"
-
-namespace Ramulator {
-
-ORAMController::ORAMController() { }
-
-ORAMController::ORAMController(int stash_size, Clk_t encrypt_delay, Clk_t decrypt_delay, IAddrMapper* m_addr_mapper,
-                              std::vector<IDRAMController*> m_controllers) {
-  this->encrypt_delay = encrypt_delay;
-  this->decrypt_delay = decrypt_delay;
-  address_logic = new AddressLogicDoubleTree(&oob_tree);
-  stash = new Stash(stash_size);
-  position_map = new PositionMap();
-  this->m_addr_mapper = m_addr_mapper;
-  this->m_controllers = m_controllers;
-}
-
-bool ORAMController::send_to_controller(Request& req) {
-  m_addr_mapper->apply(req);
-  int channel_id = req.addr_vec[0];
-  return m_controllers[channel_id]->send(req);
-}
-
-void ORAMController::decrypt_block() {
-if(curr_transaction->decrypt_cycle > m_clk) {
-    curr_transaction->decrypt_cycle += decrypt_delay;  
-  } else {
-    curr_transaction->decrypt_cycle = m_clk + decrypt_delay;
-  }
-}
-
-void ORAMController::oram_read_callback(Request& req) {
-  decrypt_block();
-  curr_transaction->n_acks--;  
-  integrity_controller->enqueue_block(req);
-
-  // Get the bucket-block memory mapping
-  int bucket_index = oram_tree_info->get_bucket_index(req.addr);
-  int block_offset = oram_tree_info->get_block_offset(req.addr);
-
-  // Get and remove the block from OOB Tree (Emulated DRAM Memory tree)
-  BlockHeader block_header = oob_tree.pop(bucket_index, block_offset);
-
-  // Check whether the block just read is dummy
-  if(block_header.is_dummy()) return;
-  
-  // If it is not dummy, then store it in the stash
-  if(!stash->add_entry(block_header)) return;
-}
-
-void ORAMController::oram_read_header_callback(Request& r) {
-  decrypt_block();
-}
-
-bool ORAMController::select_next_transaction() {
-  bool success = true;
-
-  if(curr_transaction == nullptr) {
-    if(transaction_table.empty()) {
-      success = false;
-    } else {
-      curr_transaction = &transaction_table.front();
-      // Get the effective leaf from the position map
-      curr_transaction->leaf = position_map->get_leaf(curr_transaction->block_id);
-      outdata << m_clk << "," << stash->occupancy() << std::endl;
-    }
-  }
-  return success;
-}
-
-void ORAMController::process_pending_reads() {
-  //
-  if (!pending_rd_reqs.empty()) {
-    Request& next_req = pending_rd_reqs.front();
-    if (send_to_controller(next_req)) {
-      pending_rd_reqs.pop();
-      read_requests++;
-    } else {
-      num_stall_tick++;
-    }
-  }
-}
-
-void ORAMController::process_pending_writes() {
-  if (!pending_wb_reqs.empty()) {
-    WriteRequest& next_req = pending_wb_reqs.front();
-    if(m_clk > next_req.encrypt_cycle) {
-      //Block encrypted
-      if (send_to_controller(next_req.req)) {
-        pending_wb_reqs.pop();
-        write_requests++;
-      } else {
-        num_stall_tick++;
-      }
-    }
-  }
-}
-
-void ORAMController::handle_reading_headers() {
-  Addr_t next_addr = address_logic->generate_next_hdr_address(curr_transaction->leaf);
-  if (next_addr != -1) {
-    Request load_request(next_addr, Request::Type::Read);
-    load_request.callback = [this](Request& req) {
-      this->oram_read_header_callback(req);
-    };
-    pending_rd_reqs.push(load_request);
-  } else {
-    curr_transaction->phase = Phase::ReadingData;
-  }
-}
-
-void ORAMController::handle_reading_data() {
-  Addr_t next_addr = address_logic->generate_next_address(curr_transaction->leaf);
-  if (next_addr != -1) {
-    Request load_request(next_addr, Request::Type::Read);
-    load_request.callback = [this](Request& req) {
-      this->oram_read_callback(req);
-    };
-    pending_rd_reqs.push(load_request);
-  } else {
-    curr_transaction->phase = Phase::WaitingReadsDone;
-  }
-}
-
-void ORAMController::handle_waiting_reads() {
-  if (curr_transaction->n_acks <= 0) {
-    //At this time, all the blocks have been received
-    if(m_clk > curr_transaction->decrypt_cycle && curr_transaction->integrity_checked) {
-      //Decrypt of all blocks terminated
-      curr_transaction->phase = Phase::Reply;
-    }
-  }
-}
-
-void ORAMController::handle_reply_block() {
-  if(stash->is_present(curr_transaction->block_id)) {
-    // To handle consequent requests for the same address, the
-    // remapping procedure has to be placed here, after the reading
-    // of all the blocks. Earlier or Later remappings will results
-    // in inconsistency of leaf values stored in the different data structures.
-    int new_leaf = oram_tree_info->get_random_leaf();
-    position_map->remap(curr_transaction->block_id, new_leaf);
-    stash->remap(curr_transaction->block_id, new_leaf);
-    address_logic->init_path(new_leaf);
-    curr_transaction->req.callback(curr_transaction->req);
-    level = oram_tree_info->tree_depth;
-    stash->reset();
-    curr_transaction->phase = Phase::Writing;
-    cumulative_latency += m_clk - curr_transaction->arrival_time;
-  } else {
-    throw "Block not found in either stash or memory";
-  }
-}
-
-void ORAMController::handle_writing_phase() {
-  if(stash->is_empty()) {
-    curr_transaction->phase = Phase::WritebackDummy;
-    return;
-  }
-
-  BlockHeader stash_entry = stash->next();
-  if(stash_entry.block_id == -1) {
-    curr_transaction->phase = Phase::WritebackDummy;
-  }
-  
-  int entry_block_id = stash_entry.block_id;
-  int entry_leaf = stash_entry.leaf;
-  if(address_logic->is_common_bucket(curr_transaction->leaf, entry_leaf, level)) {
-    Addr_t wb_addr = address_logic->writeback_data(entry_leaf, level, entry_block_id);
-    if(wb_addr != -1) {
-      Request write_request(wb_addr, Request::Type::Write);
-      Clk_t encrypt_cycle = m_clk + encrypt_delay;
-      pending_wb_reqs.push(WriteRequest(write_request, encrypt_cycle));
-      stash->remove_entry(entry_block_id);
-    }
-  }
-}
-
-void ORAMController::handle_writing_dummy() {
-  Addr_t wb_addr = address_logic->writeback_dummy(curr_transaction->leaf, level);
-  if(wb_addr >= 0) {
-    Request write_request(wb_addr, Request::Type::Write);
-    Clk_t encrypt_cycle = m_clk + encrypt_delay;
-    pending_wb_reqs.push(WriteRequest(write_request, encrypt_cycle));
-  } else {
-    level--;
-    if(level < 0) {
-      //printf("Stash occupancy %f\n", stash->occupancy());
-      curr_transaction->phase = Phase::WaitingWritesDone;
-    }
-  }
-}
-
-void ORAMController::handle_waiting_writes_done() {
-  if (pending_wb_reqs.empty()) {
-    if (!transaction_table.empty() && curr_transaction != nullptr) {
-      transaction_table.pop();
-    }
-    curr_transaction = nullptr;
-  }
-}
-
-void ORAMController::tick() {
-  m_clk++;
-
-  process_pending_reads();
-  process_pending_writes();
-  
-  if(!select_next_transaction()) {
-    return;
-  }  
-
-  switch (curr_transaction->phase) {
-    case Phase::Pending:
-      curr_transaction->phase = Phase::ReadingHeaders;
-      break;
-
-    case Phase::ReadingHeaders:
-      handle_reading_headers();
-      break;
-
-    case Phase::ReadingData:
-      handle_reading_data();
-      break;
-
-    case Phase::WaitingReadsDone:
-      handle_waiting_reads();
-      break;
-
-    case Phase::Reply:
-      handle_reply_block();
-      break;
-
-    case Phase::Writing:
-      handle_writing_phase();
-      break;
-
-    case Phase::WritebackDummy:
-      handle_writing_dummy();
-      break;
-
-    case Phase::WaitingWritesDone:
-      handle_waiting_writes_done();
-      break;
-
-    default:
-      break;
-  }
-}
-
-bool ORAMController::send(Request req) {
-  //Out of band init
-  if(!position_map->is_present(req.addr)) {
-    int leaf = oram_tree_info->get_random_leaf();
-    position_map->add_entry(req.addr, leaf);
-    address_logic->init_path(leaf);
-    if(!address_logic->init_block(req.addr, leaf)) exit(1);
-  }
-
-  TransactionEntry new_transaction_entry(Phase::Pending, req, req.addr, required_acks, -1, 0, false, m_clk);
-  transaction_table.push(new_transaction_entry);
-  return true;
-}
-
-void ORAMController::connect_integrity_controller(IIntegrityController* integrity_controller) {
-  this->integrity_controller = integrity_controller;
-};
-
-void ORAMController::integrity_check(Addr_t addr) {
-  curr_transaction->integrity_checked = true;
-};
-        
-void ORAMController::attach_oram_info(const ORAMTreeInfo* oram_tree_info) {
-  this->oram_tree_info = oram_tree_info;
-  address_logic->attach_oram_info(this->oram_tree_info);
-  required_acks = oram_tree_info->z_blocks * oram_tree_info->levels;
-}
-
-void ORAMController::set_counters(std::map<std::string, size_t&>& counters) {
-  counters.insert({"oram_controller_read_requests", read_requests});
-  counters.insert({"oram_controller_write_requests", write_requests});
-  counters.insert({"oram_controller_other_requests", other_requests});
-  counters.insert({"oram_controller_num_stall_tick", num_stall_tick});
-  counters.insert({"oram_controller_cumulative_latency", cumulative_latency});
-  
-}
-
+#include "memory_system/impl/oram/oram_controller.h"
+#include "memory_system/impl/oram/components/inc/address_logic_double_tree.h"
+#include "memory_system/impl/oram/components/inc/stash.h"
+#include "memory_system/impl/oram/components/inc/position_map.h"
+#include "memory_system/impl/oram/components/inc/functional_oram.h"
+
+namespace Ramulator {
+
+ORAMController::ORAMController() : phase_latency(num_phases) {
+  set_sources(1, "OldestFirst", {});
+}
+
+ORAMController::ORAMController(int stash_size, Clk_t encrypt_delay, Clk_t decrypt_delay, IAddrMapper* m_addr_mapper,
+                              std::vector<IDRAMController*> m_controllers, bool writeback_drain) : phase_latency(num_phases) {
+  this->encrypt_delay = encrypt_delay;
+  this->decrypt_delay = decrypt_delay;
+  this->writeback_drain = writeback_drain;
+  address_logic = new AddressLogicDoubleTree(&oob_tree);
+  stash = new Stash(stash_size);
+  stash_capacity = stash_size;
+  position_map = new PositionMap();
+  this->m_addr_mapper = m_addr_mapper;
+  this->m_controllers = m_controllers;
+  channel_stalls.resize(m_controllers.size());
+  channel_requests.resize(m_controllers.size());
+  set_sources(1, "OldestFirst", {});
+}
+
+int ORAMController::map_address(Request& req) {
+  if(channel_fold == 1) {
+    m_addr_mapper->apply(req);
+    int channel_idx = req.addr_vec[0] % m_controllers.size();
+    req.addr_vec[0] = m_controllers[channel_idx]->m_channel_id;
+    return channel_idx;
+  }
+
+  // The region of the partition is smaller than the memory by `channel_fold`: mapped from address 0 by a linear
+  // mapper, either its channel is already below the partition's channels (channel in the high bits) or its row
+  // is below num_rows / channel_fold (row in the high bits), so moving the channel quotient into the row is injective
+  Addr_t addr = req.addr;
+  req.addr -= oram_tree_info->base_address_tree;
+  m_addr_mapper->apply(req);
+  req.addr = addr;
+  int num_channels = m_controllers.size();
+  int channel_idx = req.addr_vec[0] % num_channels;
+  req.addr_vec[row_level] += (req.addr_vec[0] / num_channels) * (num_rows / channel_fold);
+  req.addr_vec[0] = m_controllers[channel_idx]->m_channel_id;
+  return channel_idx;
+}
+
+void ORAMController::account_request(int channel_idx, const Request& req) {
+  channel_requests[channel_idx]++;
+  int kind = static_cast<int>(ORAMRequestTag::kind(req));
+  if(req.type_id == Request::Type::Read) {
+    traffic_read_bytes[kind] += request_bytes;
+    total_read_bytes += request_bytes;
+  } else {
+    traffic_write_bytes[kind] += request_bytes;
+    total_write_bytes += request_bytes;
+  }
+}
+
+bool ORAMController::send_to_controller(Request& req) {
+  int channel_idx = map_address(req);
+  if(tracer == nullptr || curr_transaction == nullptr || !curr_transaction->traced) {
+    bool is_success = m_controllers[channel_idx]->send(req);
+    if(is_success) account_request(channel_idx, req);
+    return is_success;
+  }
+
+  // Traced transaction: reads are drawn from issue to completion, writes as instants
+  int channel_id = req.addr_vec[0];
+  int tid = TimelineTracer::channel_track(channel_id);
+  const char* kind_name = ORAMRequestTag::name(ORAMRequestTag::kind(req));
+  tracer->name_track(trace_pid, tid, fmt::format("Channel {}", channel_id));
+
+  Request traced_req = req;
+  if(req.type_id == Request::Type::Read) {
+    Clk_t issue_clk = m_clk;
+    traced_req.callback = [this, callback = req.callback, issue_clk, tid, kind_name](Request& r) {
+      this->tracer->complete(this->trace_pid, tid, kind_name, issue_clk, this->m_clk, fmt::format("\"addr\":{}", r.addr));
+      if(callback) callback(r);
+    };
+  }
+  bool is_success = m_controllers[channel_idx]->send(traced_req);
+  if(is_success) account_request(channel_idx, req);
+  if(is_success && req.type_id == Request::Type::Write) {
+    tracer->instant(trace_pid, tid, kind_name, m_clk, fmt::format("\"addr\":{}", req.addr));
+  }
+  return is_success;
+}
+
+void ORAMController::decrypt_block() {
+if(curr_transaction->decrypt_cycle > m_clk) {
+    curr_transaction->decrypt_cycle += decrypt_delay;  
+  } else {
+    curr_transaction->decrypt_cycle = m_clk + decrypt_delay;
+  }
+}
+
+void ORAMController::oram_read_callback(Request& req) {
+  decrypt_block();
+  curr_transaction->n_acks--;  
+  integrity_controller->enqueue_block(req);
+
+  // Get the bucket-block memory mapping
+  int bucket_index = oram_tree_info->get_bucket_index(req.addr);
+  int block_offset = oram_tree_info->get_block_offset(req.addr);
+
+  // Get and remove the block from OOB Tree (Emulated DRAM Memory tree)
+  BlockHeader block_header = oob_tree.pop(bucket_index, block_offset);
+
+  // Check whether the block just read is dummy
+  if(block_header.is_dummy()) return;
+  
+  // If it is not dummy, then store it in the stash
+  if(!stash->add_entry(block_header)) return;
+
+  // decrypt_cycle is now the end of the decryption of this block
+  if(block_header.block_id == curr_transaction->block_id && !curr_transaction->is_dummy) {
+    curr_transaction->target_read = true;
+    curr_transaction->target_decrypt_cycle = curr_transaction->decrypt_cycle;
+  }
+}
+
+void ORAMController::oram_read_header_callback(Request& r) {
+  decrypt_block();
+}
+
+void ORAMController::oram_read_counter_callback(Request& r) {
+  // The pads of the blocks can be generated only once their counter is available
+  if(curr_transaction->decrypt_cycle < m_clk + decrypt_delay) {
+    curr_transaction->decrypt_cycle = m_clk + decrypt_delay;
+  }
+  if(curr_transaction->target_read && curr_transaction->target_decrypt_cycle < m_clk + decrypt_delay) {
+    curr_transaction->target_decrypt_cycle = m_clk + decrypt_delay;
+  }
+  curr_transaction->counter_acks--;
+}
+
+void ORAMController::fetch_counter(Addr_t block_addr) {
+  if(counter_cache == nullptr) return;
+  Addr_t counter_addr = oram_tree_info->get_counter_address(block_addr);
+  if(counter_cache->lookup(counter_addr)) return;
+
+  Request counter_request(counter_addr, Request::Type::Read);
+  counter_request.callback = [this](Request& req) {
+    this->oram_read_counter_callback(req);
+  };
+  ORAMRequestTag::set(counter_request, ORAMRequestKind::CounterRead);
+  pending_ctr_reqs.push(counter_request);
+  curr_transaction->counter_acks++;
+
+  Addr_t victim_addr = counter_cache->fill(counter_addr);
+  if(victim_addr != -1) {
+    Request victim_request(victim_addr, Request::Type::Write);
+    ORAMRequestTag::set(victim_request, ORAMRequestKind::CounterWrite);
+    pending_ctr_reqs.push(victim_request);
+  }
+}
+
+void ORAMController::update_counter(Addr_t block_addr) {
+  if(counter_cache == nullptr) return;
+  Addr_t counter_addr = oram_tree_info->get_counter_address(block_addr);
+  if(!counter_cache->lookup(counter_addr)) {
+    // Evicted since the path read: write-allocate the line
+    Request counter_request(counter_addr, Request::Type::Read);
+    counter_request.callback = [](Request& req) {};
+    ORAMRequestTag::set(counter_request, ORAMRequestKind::CounterRead);
+    pending_ctr_reqs.push(counter_request);
+    Addr_t victim_addr = counter_cache->fill(counter_addr);
+    if(victim_addr != -1) {
+      Request victim_request(victim_addr, Request::Type::Write);
+      ORAMRequestTag::set(victim_request, ORAMRequestKind::CounterWrite);
+      pending_ctr_reqs.push(victim_request);
+    }
+  }
+
+  if(counter_cache->increment(block_addr)) {
+    // Minor counter overflow: every block sharing the line is read and re-encrypted
+    int blocks_per_line = oram_tree_info->counter_blocks_per_line;
+    Addr_t block_index = (block_addr - oram_tree_info->base_address_tree) / oram_tree_info->block_size;
+    Addr_t first_block_addr = oram_tree_info->base_address_tree + (block_index - block_index % blocks_per_line) * oram_tree_info->block_size;
+    for(int i = 0; i < blocks_per_line; i++) {
+      Addr_t addr = first_block_addr + i * oram_tree_info->block_size;
+      Request read_request(addr, Request::Type::Read);
+      read_request.callback = [](Request& req) {};
+      int addr_level = oram_tree_info->get_level(oram_tree_info->get_bucket_index(addr));
+      ORAMRequestTag::set(read_request, ORAMRequestKind::Reencryption, addr_level);
+      pending_ctr_reqs.push(read_request);
+      Request write_request(addr, Request::Type::Write);
+      ORAMRequestTag::set(write_request, ORAMRequestKind::Reencryption, addr_level);
+      pending_ctr_reqs.push(write_request);
+      reencryption_requests += 2;
+    }
+  }
+}
+
+bool ORAMController::select_next_transaction() {
+  if(curr_transaction == nullptr) {
+    admit_incoming_blocks();
+    if(access_interval > 0) {
+      // Fixed-rate mode: accesses start only at the public access slots
+      update_access_rate();
+      if(m_clk < next_access_clk) return false;
+      next_access_clk = m_clk + access_interval;
+      if(transaction_table.num_queued() == 0) {
+        generate_dummy_transaction();
+      } else {
+        real_accesses++;
+      }
+      dummy_access_ratio = dummy_accesses / (float)(dummy_accesses + real_accesses);
+    }
+
+    if(curr_transaction == nullptr) {
+      if(transaction_table.num_queued() == 0) return false;
+      for(int s = 0; s < transaction_table.num_queues(); s++) {
+        head_arrivals[s] = transaction_table.is_queue_empty(s) ? SourceArbiter::empty : transaction_table.at(transaction_table.front(s)).arrival_time;
+      }
+      curr_entry = transaction_table.dequeue(arbiter.select(head_arrivals));
+      curr_transaction = &transaction_table.at(curr_entry);
+      queueing_latency.add(m_clk - curr_transaction->arrival_time);
+      // Get the effective leaf from the position map
+      curr_transaction->leaf = position_map->get_leaf(curr_transaction->block_id);
+      // A block already in the stash is available on-chip, decrypted
+      if(early_reply && stash->is_present(curr_transaction->block_id)) {
+        curr_transaction->target_read = true;
+        curr_transaction->target_on_chip = true;
+        curr_transaction->target_decrypt_cycle = m_clk;
+      }
+    }
+    curr_transaction->traced = tracer != nullptr && tracer->sample_transaction(m_clk);
+    stash_trace.record(m_clk, stash->size());
+  }
+  return true;
+}
+
+void ORAMController::set_phase(Phase next_phase) {
+  phase_latency[static_cast<int>(curr_transaction->phase)].add(m_clk - curr_transaction->phase_start);
+  trace_phase();
+  curr_transaction->phase_start = m_clk;
+  curr_transaction->phase = next_phase;
+}
+
+void ORAMController::trace_phase() {
+  if(!curr_transaction->traced) return;
+  tracer->name_track(trace_pid, TimelineTracer::oram_fsm_track, "ORAM FSM");
+  tracer->complete(trace_pid, TimelineTracer::oram_fsm_track, phase_names[static_cast<int>(curr_transaction->phase)],
+                   curr_transaction->phase_start, m_clk,
+                   fmt::format("\"block_id\":{},\"leaf\":{},\"dummy\":{}", curr_transaction->block_id, curr_transaction->leaf, curr_transaction->is_dummy));
+}
+
+void ORAMController::generate_dummy_transaction() {
+  int leaf = oram_tree_info->get_random_leaf();
+  address_logic->init_path(leaf);
+  Request dummy_req((Addr_t)-1, Request::Type::Read);
+  TransactionEntry dummy_transaction_entry(Phase::Pending, dummy_req, -1, required_acks, leaf, 0, false, m_clk);
+  dummy_transaction_entry.is_dummy = true;
+  dummy_transaction_entry.phase_start = m_clk;
+  // Only generated when no request is waiting, so the table has room for it
+  curr_entry = transaction_table.allocate(dummy_transaction_entry);
+  curr_transaction = &transaction_table.at(curr_entry);
+  dummy_accesses++;
+}
+
+void ORAMController::update_access_rate() {
+  if(adaptive_intervals.empty() || m_clk < next_epoch_clk) return;
+
+  // The public intervals are sorted from the fastest to the slowest rate
+  Clk_t demand_interval = rate_epoch_length / std::max<size_t>(1, epoch_requests);
+  Clk_t new_interval = adaptive_intervals.front();
+  for(auto interval : adaptive_intervals) {
+    if(interval <= demand_interval) {
+      new_interval = interval;
+    }
+  }
+  if(new_interval != access_interval) {
+    rate_changes++;
+    access_interval = new_interval;
+    current_access_interval = access_interval;
+  }
+  epoch_requests = 0;
+  next_epoch_clk = m_clk + rate_epoch_length;
+}
+
+void ORAMController::process_pending_reads() {
+  //
+  if (!pending_rd_reqs.empty()) {
+    Request& next_req = pending_rd_reqs.front();
+    if (send_to_controller(next_req)) {
+      pending_rd_reqs.pop();
+      read_requests++;
+    } else {
+      record_queue_stall(next_req);
+    }
+  }
+}
+
+void ORAMController::process_pending_writes() {
+  if (!pending_wb_reqs.empty()) {
+    WriteRequest& next_req = pending_wb_reqs.front();
+    if(m_clk > next_req.encrypt_cycle) {
+      //Block encrypted
+      if (send_to_controller(next_req.req)) {
+        pending_wb_reqs.pop();
+        write_requests++;
+      } else {
+        record_queue_stall(next_req.req);
+      }
+    } else {
+      channel_stalls[next_req.channel_idx].encrypt_wait++;
+    }
+  }
+}
+
+void ORAMController::process_pending_counters() {
+  if (!pending_ctr_reqs.empty()) {
+    Request& next_req = pending_ctr_reqs.front();
+    bool is_counter_line = next_req.addr >= oram_tree_info->base_address_counters;
+    bool is_read = next_req.type_id == Request::Type::Read;
+    if (send_to_controller(next_req)) {
+      pending_ctr_reqs.pop();
+      // Re-encrypted data blocks are accounted in `reencryption_requests`
+      if(is_counter_line && is_read) {
+        counter_read_requests++;
+        counter_read_bytes += ORAMTreeInfo::counter_line_size;
+      } else if(is_counter_line) {
+        counter_write_requests++;
+        counter_write_bytes += ORAMTreeInfo::counter_line_size;
+      }
+    } else {
+      record_queue_stall(next_req);
+    }
+  }
+}
+
+void ORAMController::record_queue_stall(Request& req) {
+  num_stall_tick++;
+  ChannelStalls& stalls = channel_stalls[map_address(req)];
+  if(req.type_id == Request::Type::Read) {
+    stalls.read_queue_full++;
+  } else {
+    stalls.write_queue_full++;
+  }
+}
+
+void ORAMController::enqueue_writeback(Request& req, Clk_t encrypt_cycle) {
+  int channel_idx = map_address(req);
+  if(writeback_drain) {
+    drain_buffer.push_back(WriteRequest(req, encrypt_cycle, channel_idx));
+  } else {
+    pending_wb_reqs.push(WriteRequest(req, encrypt_cycle, channel_idx));
+  }
+}
+
+void ORAMController::flush_write_drain() {
+  if(drain_buffer.empty()) return;
+  wb_row_switches_fifo += count_row_switches(drain_buffer);
+
+  // Group per channel, then by bank and row (the column is the last level of the address vector)
+  std::map<int, std::vector<WriteRequest>> channel_writes;
+  for(auto& wr : drain_buffer) {
+    channel_writes[wr.req.addr_vec[0]].push_back(wr);
+  }
+  for(auto& [channel_id, writes] : channel_writes) {
+    std::stable_sort(writes.begin(), writes.end(), [](const WriteRequest& a, const WriteRequest& b) {
+      return std::lexicographical_compare(a.req.addr_vec.begin(), a.req.addr_vec.end() - 1,
+                                          b.req.addr_vec.begin(), b.req.addr_vec.end() - 1);
+    });
+  }
+
+  // Interleave the channels so that they drain in parallel
+  std::vector<WriteRequest> drained;
+  for(size_t i = 0; drained.size() < drain_buffer.size(); i++) {
+    for(auto& [channel_id, writes] : channel_writes) {
+      if(i < writes.size()) {
+        drained.push_back(writes[i]);
+      }
+    }
+  }
+  wb_row_switches_drained += count_row_switches(drained);
+
+  for(auto& wr : drained) {
+    pending_wb_reqs.push(wr);
+  }
+  drained_writes += drained.size();
+  drain_buffer.clear();
+}
+
+size_t ORAMController::count_row_switches(const std::vector<WriteRequest>& writes) {
+  // Key: the address vector up to the bank level; value: the last open row
+  std::map<AddrVec_t, int> open_rows;
+  size_t row_switches = 0;
+  for(auto& wr : writes) {
+    const AddrVec_t& addr_vec = wr.req.addr_vec;
+    AddrVec_t bank(addr_vec.begin(), addr_vec.end() - 2);
+    int row = addr_vec[addr_vec.size() - 2];
+    auto it = open_rows.find(bank);
+    if(it != open_rows.end() && it->second != row) {
+      row_switches++;
+    }
+    open_rows[bank] = row;
+  }
+  return row_switches;
+}
+
+void ORAMController::handle_reading_headers() {
+  Addr_t next_addr = address_logic->generate_next_hdr_address(curr_transaction->leaf);
+  if (next_addr != -1) {
+    Request load_request(next_addr, Request::Type::Read);
+    load_request.callback = [this](Request& req) {
+      this->oram_read_header_callback(req);
+    };
+    // The headers are read from the root down, one per level
+    ORAMRequestTag::set(load_request, ORAMRequestKind::HeaderRead, curr_transaction->header_level++);
+    pending_rd_reqs.push(load_request);
+  } else {
+    set_phase(Phase::ReadingData);
+  }
+}
+
+void ORAMController::handle_reading_data() {
+  Addr_t next_addr = address_logic->generate_next_address(curr_transaction->leaf);
+  if (next_addr != -1) {
+    Request load_request(next_addr, Request::Type::Read);
+    load_request.callback = [this](Request& req) {
+      this->oram_read_callback(req);
+    };
+    ORAMRequestTag::set(load_request, ORAMRequestKind::DataRead, oram_tree_info->get_level(oram_tree_info->get_bucket_index(next_addr)));
+    pending_rd_reqs.push(load_request);
+    fetch_counter(next_addr);
+  } else {
+    set_phase(Phase::WaitingReadsDone);
+  }
+}
+
+void ORAMController::handle_waiting_reads() {
+  if (curr_transaction->n_acks <= 0 && curr_transaction->counter_acks <= 0) {
+    //At this time, all the blocks have been received
+    if(m_clk <= curr_transaction->decrypt_cycle) {
+      decrypt_wait_stalls++;
+    } else if(curr_transaction->integrity_checked || release_unverified()) {
+      //Decrypt of all blocks terminated
+      set_phase(Phase::Reply);
+    } else if(verification_window > 0) {
+      verification_window_stalls++;
+    } else {
+      integrity_wait_stalls++;
+    }
+  }
+}
+
+void ORAMController::reply_to_frontend() {
+  // Open-loop frontends (BinaryTrace) send requests without a callback
+  if(curr_transaction->req.callback) curr_transaction->req.callback(curr_transaction->req);
+  curr_transaction->replied = true;
+  curr_transaction->reply_clk = m_clk;
+  cumulative_latency += m_clk - curr_transaction->arrival_time;
+  replies++;
+  reply_latency.add(m_clk - curr_transaction->arrival_time);
+  int source = curr_transaction->source;
+  source_replies[source]++;
+  source_cumulative_latency[source] += m_clk - curr_transaction->arrival_time;
+  source_avg_latency[source] = source_cumulative_latency[source] / (float)source_replies[source];
+}
+
+void ORAMController::try_early_reply() {
+  if(curr_transaction->is_dummy || !curr_transaction->target_read) return;
+  // A block held in the stash was verified when it was read: neither the counters nor the check of this path concern it
+  if(curr_transaction->target_on_chip) {
+    reply_to_frontend();
+    early_replies++;
+    return;
+  }
+  // The pad of the block needs its counter, and the reply waits for the integrity check unless it is speculative
+  if(m_clk <= curr_transaction->target_decrypt_cycle || curr_transaction->counter_acks > 0) return;
+  if(!curr_transaction->integrity_checked && !release_unverified()) return;
+  reply_to_frontend();
+  early_replies++;
+}
+
+bool ORAMController::release_unverified() {
+  if(curr_transaction->unverified) return true;
+  if(unverified_paths.size() >= verification_window) return false;
+  unverified_paths.push_back({m_clk, !curr_transaction->is_dummy});
+  unverified_paths_max = std::max(unverified_paths_max, unverified_paths.size());
+  curr_transaction->unverified = true;
+  if(!curr_transaction->is_dummy) speculative_replies++;
+  return true;
+}
+
+void ORAMController::handle_reply_block() {
+  if(curr_transaction->is_dummy) {
+    // Nothing to reply nor to remap: just evict the stash along the dummy path
+    level = oram_tree_info->tree_depth;
+    stash->reset();
+    set_phase(Phase::Writing);
+    return;
+  }
+
+  if(stash->is_present(curr_transaction->block_id)) {
+    // To handle consequent requests for the same address, the
+    // remapping procedure has to be placed here, after the reading
+    // of all the blocks. Earlier or Later remappings will results
+    // in inconsistency of leaf values stored in the different data structures.
+    int new_leaf = oram_tree_info->get_random_leaf();
+    position_map->remap(curr_transaction->block_id, new_leaf);
+    stash->remap(curr_transaction->block_id, new_leaf);
+    address_logic->init_path(new_leaf);
+    path_latency.add(m_clk - curr_transaction->arrival_time);
+    if(curr_transaction->replied) {
+      early_reply_saved_cycles += m_clk - curr_transaction->reply_clk;
+    } else {
+      reply_to_frontend();
+    }
+    if(remap_callback) remap_callback(curr_transaction->block_id);
+    level = oram_tree_info->tree_depth;
+    stash->reset();
+    set_phase(Phase::Writing);
+  } else {
+    throw "Block not found in either stash or memory";
+  }
+}
+
+void ORAMController::handle_writing_phase() {
+  if(stash->is_empty()) {
+    set_phase(Phase::WritebackDummy);
+    return;
+  }
+
+  BlockHeader stash_entry = stash->next();
+  if(stash_entry.block_id == -1) {
+    // End of the scan: the sentinel is neither a stall nor a failed writeback
+    set_phase(Phase::WritebackDummy);
+    return;
+  }
+  
+  int entry_block_id = stash_entry.block_id;
+  int entry_leaf = stash_entry.leaf;
+  bool written = false;
+  if(address_logic->is_common_bucket(curr_transaction->leaf, entry_leaf, level)) {
+    Addr_t wb_addr = address_logic->writeback_data(entry_leaf, level, entry_block_id);
+    if(wb_addr == -1) {
+      level_writeback_failures[level]++;
+    } else {
+      written = true;
+      Request write_request(wb_addr, Request::Type::Write);
+      ORAMRequestTag::set(write_request, ORAMRequestKind::RealWriteback, level);
+      Clk_t encrypt_cycle = m_clk + encrypt_delay;
+      enqueue_writeback(write_request, encrypt_cycle);
+      stash->remove_entry(entry_block_id);
+      update_counter(wb_addr);
+    }
+  }
+  if(!written) {
+    stash_scan_stalls++;
+  }
+}
+
+void ORAMController::handle_writing_dummy() {
+  Addr_t wb_addr = address_logic->writeback_dummy(curr_transaction->leaf, level);
+  if(wb_addr >= 0) {
+    Request write_request(wb_addr, Request::Type::Write);
+    ORAMRequestTag::set(write_request, ORAMRequestKind::DummyWriteback, level);
+    Clk_t encrypt_cycle = m_clk + encrypt_delay;
+    enqueue_writeback(write_request, encrypt_cycle);
+    update_counter(wb_addr);
+  } else {
+    level--;
+    if(level < 0) {
+      //printf("Stash occupancy %f\n", stash->occupancy());
+      flush_write_drain();
+      update_stash_statistics();
+      set_phase(Phase::WaitingWritesDone);
+    }
+  }
+}
+
+void ORAMController::handle_waiting_writes_done() {
+  if (pending_wb_reqs.empty()) {
+    phase_latency[static_cast<int>(Phase::WaitingWritesDone)].add(m_clk - curr_transaction->phase_start);
+    trace_phase();
+    if(!curr_transaction->is_dummy) {
+      transaction_latency.add(m_clk - curr_transaction->arrival_time);
+    }
+    for(auto& histogram : phase_latency) {
+      histogram.refresh();
+    }
+    queueing_latency.refresh();
+    reply_latency.refresh();
+    path_latency.refresh();
+    transaction_latency.refresh();
+
+    table_occupancy_mean = table_occupancy_sum / (float)table_occupancy_samples;
+
+    transaction_table.release(curr_entry);
+    curr_entry = -1;
+    curr_transaction = nullptr;
+  }
+}
+
+void ORAMController::tick() {
+  PATHORAM_PROFILE_SCOPE(ORAMController);
+  m_clk++;
+
+  process_pending_reads();
+  process_pending_writes();
+  process_pending_counters();
+
+  table_occupancy_sum += transaction_table.size();
+  table_occupancy_samples++;
+  table_occupancy_max = std::max(table_occupancy_max, transaction_table.size());
+  
+  if(!select_next_transaction()) {
+    return;
+  }  
+
+  if(early_reply && !curr_transaction->replied) {
+    try_early_reply();
+  }
+
+  switch (curr_transaction->phase) {
+    case Phase::Pending:
+      set_phase(Phase::ReadingHeaders);
+      break;
+
+    case Phase::ReadingHeaders:
+      handle_reading_headers();
+      break;
+
+    case Phase::ReadingData:
+      handle_reading_data();
+      break;
+
+    case Phase::WaitingReadsDone:
+      handle_waiting_reads();
+      break;
+
+    case Phase::Reply:
+      handle_reply_block();
+      break;
+
+    case Phase::Writing:
+      handle_writing_phase();
+      break;
+
+    case Phase::WritebackDummy:
+      handle_writing_dummy();
+      break;
+
+    case Phase::WaitingWritesDone:
+      handle_waiting_writes_done();
+      break;
+
+    default:
+      break;
+  }
+}
+
+void ORAMController::init_block(Addr_t block_id) {
+  int leaf = oram_tree_info->get_random_leaf();
+  position_map->add_entry(block_id, leaf);
+  address_logic->init_path(leaf);
+  if(!address_logic->init_block(block_id, leaf)) exit(1);
+}
+
+bool ORAMController::send(Request req) {
+  int source = std::max(req.source_id, 0);
+  if(source >= transaction_table.num_queues()) {
+    throw std::runtime_error(fmt::format("Request from source {}, but only {} sources are configured (num_sources)", req.source_id, transaction_table.num_queues()));
+  }
+  // Backpressure: the frontend keeps the request and retries it
+  if(transaction_table.is_full()) {
+    table_rejections++;
+    return false;
+  }
+
+  //Out of band init, only for an admitted request: a refused one leaves the ORAM untouched
+  if(!position_map->is_present(req.addr)) {
+    init_block(req.addr);
+  }
+
+  TransactionEntry new_transaction_entry(Phase::Pending, req, req.addr, required_acks, -1, 0, false, m_clk);
+  new_transaction_entry.phase_start = m_clk;
+  new_transaction_entry.source = source;
+  transaction_table.push(source, new_transaction_entry);
+  source_requests[source]++;
+  epoch_requests++;
+  return true;
+}
+
+void ORAMController::functional_access(Addr_t block_id) {
+  admit_incoming_blocks();
+  if(!position_map->is_present(block_id)) {
+    init_block(block_id);
+  }
+  FunctionalORAM::access_path(block_id, oram_tree_info, position_map, stash, address_logic, oob_tree);
+}
+
+bool ORAMController::is_idle() {
+  return curr_transaction == nullptr && transaction_table.size() == 0 && pending_rd_reqs.empty() &&
+         pending_wb_reqs.empty() && pending_ctr_reqs.empty() && drain_buffer.empty() && unverified_paths.empty() && incoming_blocks.empty();
+}
+
+void ORAMController::connect_integrity_controller(IIntegrityController* integrity_controller) {
+  this->integrity_controller = integrity_controller;
+};
+
+void ORAMController::integrity_check(Addr_t addr) {
+  // The paths are verified in order: a path let through unverified is older than the current one
+  if(!unverified_paths.empty()) {
+    UnverifiedPath path = unverified_paths.front();
+    unverified_paths.pop_front();
+    if(path.is_reply) speculation_saved_cycles += m_clk - path.release_clk;
+    return;
+  }
+  curr_transaction->integrity_checked = true;
+};
+        
+bool ORAMController::migrate_out(Addr_t block_id) {
+  if(!stash->is_present(block_id)) return false;
+  stash->remove_entry(block_id);
+  position_map->remove_entry(block_id);
+  return true;
+}
+
+bool ORAMController::can_migrate_in() {
+  return stash->size() + (int)incoming_blocks.size() < stash_capacity;
+}
+
+void ORAMController::migrate_in(Addr_t block_id) {
+  // The position map entry is added at once, so that a request for the block does not initialise it again
+  int leaf = oram_tree_info->get_random_leaf();
+  position_map->add_entry(block_id, leaf);
+  incoming_blocks.push_back(BlockHeader(block_id, leaf));
+}
+
+void ORAMController::admit_incoming_blocks() {
+  for(auto& block : incoming_blocks) {
+    address_logic->init_path(block.leaf);
+    stash->add_entry(block);
+  }
+  incoming_blocks.clear();
+}
+
+void ORAMController::attach_oram_info(const ORAMTreeInfo* oram_tree_info) {
+  this->oram_tree_info = oram_tree_info;
+  address_logic->attach_oram_info(this->oram_tree_info);
+  required_acks = oram_tree_info->z_blocks * oram_tree_info->levels;
+  level_writeback_failures.assign(oram_tree_info->levels, 0);
+}
+
+void ORAMController::set_access_rate(Clk_t access_interval, std::vector<Clk_t> adaptive_intervals, Clk_t rate_epoch_length) {
+  std::sort(adaptive_intervals.begin(), adaptive_intervals.end());
+  if(access_interval == 0 && !adaptive_intervals.empty()) {
+    access_interval = adaptive_intervals.back();
+  }
+  this->access_interval = access_interval;
+  this->adaptive_intervals = adaptive_intervals;
+  this->rate_epoch_length = rate_epoch_length;
+  next_epoch_clk = rate_epoch_length;
+  current_access_interval = access_interval;
+}
+
+void ORAMController::attach_counter_cache(ICounterCache* counter_cache) {
+  this->counter_cache = counter_cache;
+}
+
+void ORAMController::update_stash_statistics() {
+  if(bucket_stats_period > 0 && stash_statistics.evictions % bucket_stats_period == 0) {
+    oob_tree.sample_level_occupancy();
+  }
+  stash_statistics.record(stash);
+  stash_statistics.refresh(stash);
+}
+
+void ORAMController::set_transaction_table_size(size_t size) {
+  transaction_table_size = size;
+  transaction_table = TransactionTable<TransactionEntry>(transaction_table.num_queues(), size);
+}
+
+void ORAMController::set_sources(int num_sources, const std::string& policy, std::vector<int> weights) {
+  arbiter = SourceArbiter(policy, num_sources, weights);
+  transaction_table = TransactionTable<TransactionEntry>(num_sources, transaction_table_size);
+  head_arrivals.resize(num_sources);
+  source_requests.assign(num_sources, 0);
+  source_replies.assign(num_sources, 0);
+  source_cumulative_latency.assign(num_sources, 0);
+  source_avg_latency.assign(num_sources, 0);
+}
+
+void ORAMController::set_channel_folding(int fold, int row_level, int num_rows) {
+  if(fold > 1 && num_rows % fold != 0) {
+    throw std::runtime_error(fmt::format("The rows of a bank ({}) must be a multiple of the number of partitions ({})", num_rows, fold));
+  }
+  this->channel_fold = fold;
+  this->row_level = row_level;
+  this->num_rows = num_rows;
+}
+
+void ORAMController::set_request_bytes(int bytes) {
+  request_bytes = bytes;
+}
+
+void ORAMController::set_bucket_stats_period(int period) {
+  bucket_stats_period = period;
+  if(period > 0) {
+    oob_tree.attach_oram_info(oram_tree_info);
+  }
+}
+
+void ORAMController::set_stash_targets(std::vector<int> candidate_sizes, std::vector<int> lambdas) {
+  stash_statistics.set_targets(candidate_sizes, lambdas);
+}
+
+void ORAMController::reset_stats() {
+  for(auto& histogram : phase_latency) {
+    histogram.reset();
+  }
+  queueing_latency.reset();
+  reply_latency.reset();
+  path_latency.reset();
+  transaction_latency.reset();
+  std::fill(source_avg_latency.begin(), source_avg_latency.end(), 0);
+  table_occupancy_sum = 0;
+  table_occupancy_samples = 0;
+  table_occupancy_mean = 0;
+  stash->reset_occupancy_distribution();
+  stash_statistics.reset();
+  oob_tree.reset_stats();
+}
+
+int ORAMController::get_stash_size() {
+  return stash->size();
+}
+
+void ORAMController::attach_tracer(TimelineTracer* tracer, int pid) {
+  this->tracer = tracer;
+  this->trace_pid = pid;
+}
+
+void ORAMController::set_counters(std::map<std::string, size_t&>& counters) {
+  counters.insert({"oram_controller_read_requests", read_requests});
+  counters.insert({"oram_controller_write_requests", write_requests});
+  counters.insert({"oram_controller_other_requests", other_requests});
+  counters.insert({"oram_controller_num_stall_tick", num_stall_tick});
+  counters.insert({"oram_controller_cumulative_latency", cumulative_latency});
+  counters.insert({"oram_controller_replies", replies});
+  counters.insert({"oram_controller_counter_read_requests", counter_read_requests});
+  counters.insert({"oram_controller_counter_write_requests", counter_write_requests});
+  counters.insert({"oram_controller_counter_read_bytes", counter_read_bytes});
+  counters.insert({"oram_controller_counter_write_bytes", counter_write_bytes});
+  counters.insert({"oram_controller_reencryption_requests", reencryption_requests});
+  counters.insert({"oram_controller_drained_writes", drained_writes});
+  counters.insert({"oram_controller_wb_row_switches_fifo", wb_row_switches_fifo});
+  counters.insert({"oram_controller_wb_row_switches_drained", wb_row_switches_drained});
+  counters.insert({"oram_controller_real_accesses", real_accesses});
+  counters.insert({"oram_controller_dummy_accesses", dummy_accesses});
+  counters.insert({"oram_controller_rate_changes", rate_changes});
+  counters.insert({"oram_controller_early_replies", early_replies});
+  counters.insert({"oram_controller_early_reply_saved_cycles", early_reply_saved_cycles});
+  counters.insert({"oram_controller_speculative_replies", speculative_replies});
+  counters.insert({"oram_controller_speculation_saved_cycles", speculation_saved_cycles});
+  counters.insert({"oram_controller_stall_verification_window", verification_window_stalls});
+  counters.insert({"oram_controller_unverified_paths_max", unverified_paths_max});
+  counters.insert({"oram_controller_transaction_table_rejections", table_rejections});
+  counters.insert({"oram_controller_transaction_table_occupancy_max", table_occupancy_max});
+  stash_statistics.set_counters(counters, "oram_controller_stash");
+  counters.insert({"oram_controller_stall_decrypt_wait", decrypt_wait_stalls});
+  counters.insert({"oram_controller_stall_integrity_wait", integrity_wait_stalls});
+  counters.insert({"oram_controller_stall_stash_scan", stash_scan_stalls});
+  counters.insert({"oram_controller_traffic_read_bytes", total_read_bytes});
+  counters.insert({"oram_controller_traffic_write_bytes", total_write_bytes});
+  for(int k = 1; k < ORAMRequestTag::num_kinds; k++) {
+    const char* kind_name = ORAMRequestTag::name(static_cast<ORAMRequestKind>(k));
+    counters.insert({fmt::format("oram_controller_traffic_{}_read_bytes", kind_name), traffic_read_bytes[k]});
+    counters.insert({fmt::format("oram_controller_traffic_{}_write_bytes", kind_name), traffic_write_bytes[k]});
+  }
+  for(size_t level = 0; level < level_writeback_failures.size(); level++) {
+    counters.insert({fmt::format("oram_controller_level{}_writeback_failures", level), level_writeback_failures[level]});
+  }
+  oob_tree.set_counters(counters);
+  // Per-source service, only with more than one source (otherwise it is the controller's total)
+  if(source_requests.size() > 1) {
+    for(size_t s = 0; s < source_requests.size(); s++) {
+      counters.insert({fmt::format("oram_controller_source{}_requests", s), source_requests[s]});
+      counters.insert({fmt::format("oram_controller_source{}_replies", s), source_replies[s]});
+      counters.insert({fmt::format("oram_controller_source{}_cumulative_latency", s), source_cumulative_latency[s]});
+    }
+  }
+  for(size_t i = 0; i < m_controllers.size(); i++) {
+    std::string prefix = fmt::format("oram_controller_ch{}_stall", m_controllers[i]->m_channel_id);
+    counters.insert({prefix + "_read_queue_full", channel_stalls[i].read_queue_full});
+    counters.insert({prefix + "_write_queue_full", channel_stalls[i].write_queue_full});
+    counters.insert({prefix + "_encrypt_wait", channel_stalls[i].encrypt_wait});
+    counters.insert({fmt::format("oram_controller_ch{}_requests", m_controllers[i]->m_channel_id), channel_requests[i]});
+  }
+  for(int i = 0; i < num_phases; i++) {
+    phase_latency[i].set_counters(counters, fmt::format("oram_controller_latency_{}", phase_names[i]));
+  }
+  queueing_latency.set_counters(counters, "oram_controller_latency_queueing");
+  reply_latency.set_counters(counters, "oram_controller_latency_reply");
+  path_latency.set_counters(counters, "oram_controller_latency_path");
+  transaction_latency.set_counters(counters, "oram_controller_latency_transaction");
+  
+}
+
+void ORAMController::set_metrics(std::map<std::string, float&>& metrics) {
+  metrics.insert({"oram_controller_dummy_access_ratio", dummy_access_ratio});
+  metrics.insert({"oram_controller_access_interval", current_access_interval});
+  metrics.insert({"oram_controller_transaction_table_occupancy_mean", table_occupancy_mean});
+  stash_statistics.set_metrics(metrics, "oram_controller_stash");
+  oob_tree.set_metrics(metrics);
+  if(source_avg_latency.size() > 1) {
+    for(size_t s = 0; s < source_avg_latency.size(); s++) {
+      metrics.insert({fmt::format("oram_controller_source{}_avg_latency", s), source_avg_latency[s]});
+    }
+  }
+}
+
 }   // namespace Ramulator
\ No newline at end of file
@@ -1,222 +1,607 @@
-#ifndef ORAM_BACKEND_H
-#define ORAM_BACKEND_H
-
-#include <queue>
-#include <map>
-#include <string>
-
-#include "base/base.h"
-#include "base/request.h"
-#include "base/clocked.h"
-#include "dram_controller/controller.h"
-#include "addr_mapper/addr_mapper.h"
-
-#include "memory_system/impl/oram/oob/oob_tree.h"
-#include "memory_system/impl/oram/oob/bucket.h"
-
-#include "memory_system/impl/oram/components/interfaces/iposition_map.h"
-#include "memory_system/impl/oram/components/interfaces/iaddress_logic.h"
-#include "memory_system/impl/oram/components/interfaces/istash.h"
-#include "memory_system/impl/oram/components/interfaces/ioram_controller.h"
-#include "memory_system/impl/oram/components/interfaces/iintegrity_controller.h"
-
-#include "memory_system/impl/oram/components/inc/oram_tree_info.h"
-
-#include <fstream>
-
-namespace Ramulator {
-
-/**
- * @class ORAMController
- * @brief The main ORAM controller responsible for managing all subcomponents and data flow.
- *
- * The ORAMController is the core manager of ORAM operations. It contains
- * the Stash, Position Map, Address Logic, a Finite State Machine for each request,
- * a table of pending memory transactions, and a reference to the Out-of-Band ORAM structure.
- * 
- * Whenever a request is received from the CPU, it is enqueued in the transaction table.
- * If no other transactions are currently being executed, the next one in line is selected.
- * 
- * It handles remapping operations and ensures consistency between data structures.
- *
- * @note This controller can be extended for further improvements.
- */
-
-class ORAMController : public IORAMController, Clocked<ORAMController> {
-        /**
-         * @brief Represents the current phase of an ORAM transaction.
-         */
-        enum class Phase {Pending, ReadingHeaders, ReadingData, Reply, WaitingReadsDone, Writing, WritebackDummy, WaitingWritesDone};
-
-        struct TransactionEntry {
-            Phase phase;
-            Request req;
-            Addr_t block_id;
-            int n_acks;
-            int leaf;
-            Clk_t decrypt_cycle;
-            bool integrity_checked;
-            Clk_t arrival_time;
-        };
-
-        struct WriteRequest {
-            Request req;
-            Clk_t encrypt_cycle;
-        };
-    public:
-        std::ofstream outdata;
-        
-    private:
-        int level;
-        int required_acks;
-        Clk_t encrypt_delay;
-        Clk_t decrypt_delay;
-
-        //Counters
-        size_t read_requests = 0;
-        size_t write_requests = 0;
-        size_t other_requests = 0;
-        size_t num_stall_tick = 0;
-        size_t cumulative_latency = 0;
-
-        // ORAM Components
-        IIntegrityController* integrity_controller;
-        IAddrMapper* m_addr_mapper;
-        std::vector<IDRAMController*> m_controllers;
-        const ORAMTreeInfo* oram_tree_info;
-        IPositionMap* position_map;
-        IStash* stash;
-        IAddressLogic* address_logic;
-        
-        // Transaction's queue
-        std::queue<TransactionEntry> transaction_table;
-        TransactionEntry* curr_transaction;
-
-        // Requests' queue to memory
-        std::queue<Request> pending_rd_reqs;
-
-        std::queue<WriteRequest> pending_wb_reqs;
-        
-        //Out of band tree
-        OOBTree oob_tree;
-
-        /**
-         * @brief  Send the request to the real DRAM Controller
-         */
-        bool send_to_controller(Request& req);
-
-        /**
-         * @brief When a block is received (dummy or data) from memory, it is decrypted.
-         * This is modelled as an delay added to the current Clock cycle.
-         */
-        void decrypt_block();
-
-        /**
-         * @brief  Callback to be called when the DRAM Controller completes a READ request
-         * @details 
-         * When a READ request is completed, the controller calls this callback to
-         * update some ORAM Controller information and populate the stash.
-         */
-        void oram_read_callback(Request& r);
-        void oram_read_header_callback(Request& r);
-
-        /**
-         * @brief Selects the next transaction from the transaction table if none is currently active.
-         *
-         * If there is no current transaction in progress (`curr_transaction == nullptr`) and the
-         * transaction table is not empty, the front transaction is selected for processing.
-         *
-         * @return `true` if a transaction is selected or already active, `false` if the transaction table is empty.
-         */
-        bool select_next_transaction();
-
-        /**
-         * @brief Processes any pending read requests in the queue.
-         *        If a request is ready and the controller accepts it, it is removed from the queue.
-         */
-        void process_pending_reads();
-
-        /**
-         * @brief Processes any pending writeback requests in the queue.
-         *        If a request is ready and the controller accepts it, it is sent and removed from the queue.
-         */
-        void process_pending_writes();
-
-        /**
-         * @brief Handles the phase where headers are being read from the ORAM tree.
-         *        Requests are generated based on the transaction’s target leaf.
-         *        Finally, the requests are buffered into the read queue.
-         */
-        void handle_reading_headers();
-
-        /**
-         * @brief Handles the phase where actual data blocks are being read.
-         *        Requests are generated and callbacks attached for processing read completions.
-         *        Finally, the requests are buffered into the read queue.
-         */
-        void handle_reading_data();
-
-        /**
-         * @brief Handles the phase where it has to wait the blocks to be read.
-         */
-        void handle_waiting_reads();
-
-        /**
-         * @brief After the reading phase, return the request block to the LLC.
-         *        It should be in the stash.
-         */
-        void handle_reply_block();
-        
-        /**
-         * @brief Handles the writing phase by selecting blocks from the stash and issuing write requests
-         *        if a valid location on the path is available.
-         *        The requests are buffered into the write queue.
-         */
-        void handle_writing_phase();
-        void handle_writing_dummy();
-
-        /**
-         * @brief Finalizes the current transaction after all writebacks are completed.
-         *        Removes the transaction from the table.
-         */
-        void handle_waiting_writes_done();
-
-    public:
-        ORAMController();
-
-        ORAMController(int stash_size, Clk_t encrypt_delay, Clk_t decrypt_delay, IAddrMapper* m_addr_mapper,
-                              std::vector<IDRAMController*> m_controllers);
-        
-        /**
-         * @brief  Advances the ORAM controller simulation by one clock cycle.
-         * @details 
-         * This method updates the internal state of the ORAM controller 
-         * and processes any scheduled operations for the current cycle.
-         */
-        void tick() override;
-
-        /**
-         * @brief  Sends a request to the ORAM controller.
-         * @details 
-         * This method handles an incoming request (e.g., read or write) from the CPU
-         * and returns whether the request was successfully buffered or processed.
-         * @return true if the request was accepted, false otherwise.
-         */
-        bool send(Request req) override;
-
-        void connect_integrity_controller(IIntegrityController* integrity_controller) override;
-
-        void integrity_check(Addr_t addr) override;
-
-        void attach_oram_info(const ORAMTreeInfo* oram_tree_info) override;
-
-        /**
-         * @brief  Attach the PathORAM's access counter to ORAMCounter.
-         */
-        void set_counters(std::map<std::string, size_t&>& counters) override;
-};
-
-
-}
-
+#ifndef ORAM_BACKEND_H
+#define ORAM_BACKEND_H
+
+#include <queue>
+#include <deque>
+#include <map>
+#include <vector>
+#include <algorithm>
+#include <string>
+
+#include "base/base.h"
+#include "base/request.h"
+#include "base/clocked.h"
+#include "dram_controller/controller.h"
+#include "addr_mapper/addr_mapper.h"
+
+#include "memory_system/impl/oram/oob/oob_tree.h"
+#include "memory_system/impl/oram/oob/bucket.h"
+
+#include "memory_system/impl/oram/components/interfaces/iposition_map.h"
+#include "memory_system/impl/oram/components/interfaces/iaddress_logic.h"
+#include "memory_system/impl/oram/components/interfaces/istash.h"
+#include "memory_system/impl/oram/components/interfaces/ioram_controller.h"
+#include "memory_system/impl/oram/components/interfaces/iintegrity_controller.h"
+#include "memory_system/impl/oram/components/interfaces/icounter_cache.h"
+
+#include "memory_system/impl/oram/components/inc/oram_tree_info.h"
+#include "memory_system/impl/oram/components/inc/latency_histogram.h"
+#include "memory_system/impl/oram/components/inc/stash_statistics.h"
+#include "memory_system/impl/oram/components/inc/host_profiler.h"
+#include "memory_system/impl/oram/components/inc/stash_trace_writer.h"
+#include "memory_system/impl/oram/components/inc/timeline_tracer.h"
+#include "memory_system/impl/oram/components/inc/oram_request_tag.h"
+#include "memory_system/impl/oram/components/inc/source_arbiter.h"
+#include "memory_system/impl/oram/components/inc/transaction_table.h"
+
+namespace Ramulator {
+
+/**
+ * @class ORAMController
+ * @brief The main ORAM controller responsible for managing all subcomponents and data flow.
+ *
+ * The ORAMController is the core manager of ORAM operations. It contains
+ * the Stash, Position Map, Address Logic, a Finite State Machine for each request,
+ * a table of pending memory transactions, and a reference to the Out-of-Band ORAM structure.
+ * 
+ * Whenever a request is received from the CPU, it is enqueued in the transaction table, in the
+ * queue of its source (`req.source_id`, e.g. the core); if the table is full the request is refused
+ * and the frontend retries it later. If no other transaction is currently being executed,
+ * the SourceArbiter chooses the source whose oldest transaction is selected next.
+ * 
+ * It handles remapping operations and ensures consistency between data structures.
+ *
+ * @note This controller can be extended for further improvements.
+ */
+
+class ORAMController : public IORAMController, Clocked<ORAMController> {
+        /**
+         * @brief Represents the current phase of an ORAM transaction.
+         */
+        enum class Phase {Pending, ReadingHeaders, ReadingData, Reply, WaitingReadsDone, Writing, WritebackDummy, WaitingWritesDone};
+        static constexpr int num_phases = 8;
+        static constexpr const char* phase_names[num_phases] = {"pending", "reading_headers", "reading_data", "reply",
+                                                                "waiting_reads_done", "writing", "writeback_dummy", "waiting_writes_done"};
+
+        struct TransactionEntry {
+            Phase phase;
+            Request req;
+            Addr_t block_id;
+            int n_acks;
+            int leaf;
+            Clk_t decrypt_cycle;
+            bool integrity_checked;
+            Clk_t arrival_time;
+            int counter_acks = 0;
+            bool is_dummy = false;
+            Clk_t phase_start = 0;
+            bool traced = false;
+            int header_level = 0;
+            int source = 0;
+            // Early reply: the target block has been read and is decrypted at target_decrypt_cycle, or it was
+            // already in the stash (on-chip, decrypted and verified); replied is set once the LLC has been answered
+            bool target_read = false;
+            bool target_on_chip = false;
+            Clk_t target_decrypt_cycle = 0;
+            bool replied = false;
+            Clk_t reply_clk = 0;
+            // Speculative reply: the path has been let through before its verification
+            bool unverified = false;
+        };
+
+        struct UnverifiedPath {
+            Clk_t release_clk;
+            bool is_reply;
+        };
+
+        struct WriteRequest {
+            Request req;
+            Clk_t encrypt_cycle;
+            // Mapped once at the enqueue, to attribute the encryption stalls
+            int channel_idx;
+        };
+    public:
+        StashTraceWriter stash_trace;
+        
+    private:
+        int level;
+        int required_acks;
+        Clk_t encrypt_delay;
+        Clk_t decrypt_delay;
+        bool writeback_drain;
+        bool early_reply = false;
+
+        // Called with the block id once a served block has been remapped (it is in the stash, on its new leaf)
+        std::function<void(Addr_t)> remap_callback;
+
+        // Blocks migrated in from another partition, with their new leaf: they enter the stash between two
+        // transactions, never during the scan of the writing phase. They count towards the stash capacity
+        int stash_capacity;
+        std::vector<BlockHeader> incoming_blocks;
+
+        // Speculative reply (verification_window = 0 keeps the integrity check on the reply path):
+        // paths let through before their verification, in the order the Integrity Controller checks them
+        size_t verification_window = 0;
+        std::deque<UnverifiedPath> unverified_paths;
+
+        // Fixed-rate access mode (access_interval = 0 means on-demand accesses)
+        Clk_t access_interval = 0;
+        Clk_t next_access_clk = 0;
+        std::vector<Clk_t> adaptive_intervals;
+        Clk_t rate_epoch_length = 0;
+        Clk_t next_epoch_clk = 0;
+        size_t epoch_requests = 0;
+
+        //Counters
+        size_t read_requests = 0;
+        size_t write_requests = 0;
+        size_t other_requests = 0;
+        size_t num_stall_tick = 0;
+        size_t cumulative_latency = 0;
+        size_t counter_read_requests = 0;
+        size_t counter_write_requests = 0;
+        size_t counter_read_bytes = 0;
+        size_t counter_write_bytes = 0;
+        size_t reencryption_requests = 0;
+        size_t drained_writes = 0;
+        size_t wb_row_switches_fifo = 0;
+        size_t wb_row_switches_drained = 0;
+        size_t real_accesses = 0;
+        size_t dummy_accesses = 0;
+        size_t rate_changes = 0;
+        float dummy_access_ratio = 0;
+        float current_access_interval = 0;
+
+        // Stash occupancy after each eviction, its percentiles and the tail fit
+        StashStatistics stash_statistics;
+
+        // Per-level bucket occupancy, sampled every `bucket_stats_period` evictions, and
+        // stash entries that could not be placed in the full bucket of their level
+        int bucket_stats_period = 0;
+        std::vector<size_t> level_writeback_failures;
+
+        // Stall attribution: per-channel stalls (DRAM queue full, write waiting for the encryption)
+        // and controller-wide stalls (decryption, integrity check, stash scans without a writeback)
+        struct ChannelStalls {
+            size_t read_queue_full = 0;
+            size_t write_queue_full = 0;
+            size_t encrypt_wait = 0;
+        };
+        std::vector<ChannelStalls> channel_stalls;
+        std::vector<size_t> channel_requests;
+        size_t replies = 0;
+
+        // DRAM traffic in bytes, per request kind (indexed by ORAMRequestKind) and in total
+        int request_bytes = 64;
+
+        // Partitions: number of partitions sharing the channels (1 maps the addresses as they are),
+        // index of the row level in the address vector and number of rows of a bank
+        int channel_fold = 1;
+        int row_level = -1;
+        int num_rows = 0;
+        size_t traffic_read_bytes[ORAMRequestTag::num_kinds] = {};
+        size_t traffic_write_bytes[ORAMRequestTag::num_kinds] = {};
+        size_t total_read_bytes = 0;
+        size_t total_write_bytes = 0;
+        size_t decrypt_wait_stalls = 0;
+        size_t integrity_wait_stalls = 0;
+        size_t stash_scan_stalls = 0;
+
+        // Latency histograms: time spent in each phase, queueing in the transaction table,
+        // arrival to reply, arrival to the end of the path read and arrival to the end of the writeback
+        std::vector<LatencyHistogram> phase_latency;
+        LatencyHistogram queueing_latency;
+        LatencyHistogram reply_latency;
+        LatencyHistogram path_latency;
+        LatencyHistogram transaction_latency;
+
+        // Early reply: replies sent before the end of the path read and the cycles they saved
+        size_t early_replies = 0;
+        size_t early_reply_saved_cycles = 0;
+
+        // Speculative reply: replies sent before their verification, the cycles between the reply and
+        // the verification, and the cycles a path waited because the verification window was full
+        size_t speculative_replies = 0;
+        size_t speculation_saved_cycles = 0;
+        size_t verification_window_stalls = 0;
+        size_t unverified_paths_max = 0;
+
+        // ORAM Components
+        IIntegrityController* integrity_controller;
+        IAddrMapper* m_addr_mapper;
+        std::vector<IDRAMController*> m_controllers;
+        const ORAMTreeInfo* oram_tree_info;
+        IPositionMap* position_map;
+        IStash* stash;
+        IAddressLogic* address_logic;
+        ICounterCache* counter_cache = nullptr;
+        TimelineTracer* tracer = nullptr;
+        int trace_pid = 0;
+        
+        // Transaction table (one queue per source, 0 entries for an unbounded table) and the
+        // transaction being executed, which holds its entry until the end of its writeback
+        size_t transaction_table_size = 0;
+        TransactionTable<TransactionEntry> transaction_table;
+        int curr_entry = -1;
+        TransactionEntry* curr_transaction = nullptr;
+
+        // Backpressure: requests refused because the table was full, and table occupancy per cycle
+        size_t table_rejections = 0;
+        size_t table_occupancy_max = 0;
+        size_t table_occupancy_sum = 0;
+        size_t table_occupancy_samples = 0;
+        float table_occupancy_mean = 0;
+
+        // Arbitration among the sources and per-source service
+        SourceArbiter arbiter;
+        std::vector<Clk_t> head_arrivals;
+        std::vector<size_t> source_requests;
+        std::vector<size_t> source_replies;
+        std::vector<size_t> source_cumulative_latency;
+        std::vector<float> source_avg_latency;
+
+        // Requests' queue to memory
+        std::queue<Request> pending_rd_reqs;
+
+        std::queue<WriteRequest> pending_wb_reqs;
+
+        // Write-drain stage: a path's writebacks are batched here before being reordered
+        std::vector<WriteRequest> drain_buffer;
+
+        // Counters' fetches, evictions and re-encryptions, issued in parallel with the path
+        std::queue<Request> pending_ctr_reqs;
+        
+        //Out of band tree
+        OOBTree oob_tree;
+
+        /**
+         * @brief  Applies the address mapping to the request. The channel is folded onto the
+         * channels assigned to this controller (its partition's channel group): with more than one
+         * partition the channel bits folded away are moved into the row, so no two addresses alias.
+         * @return The index of the target DRAM Controller in `m_controllers`.
+         */
+        int map_address(Request& req);
+
+        /**
+         * @brief  Send the request to the real DRAM Controller
+         */
+        bool send_to_controller(Request& req);
+
+        /**
+         * @brief When a block is received (dummy or data) from memory, it is decrypted.
+         * This is modelled as an delay added to the current Clock cycle.
+         */
+        void decrypt_block();
+
+        /**
+         * @brief  Callback to be called when the DRAM Controller completes a READ request
+         * @details 
+         * When a READ request is completed, the controller calls this callback to
+         * update some ORAM Controller information and populate the stash.
+         */
+        void oram_read_callback(Request& r);
+        void oram_read_header_callback(Request& r);
+        void oram_read_counter_callback(Request& r);
+
+        /**
+         * @brief Looks up the counter of a data block being read in the Counter Cache.
+         * On a miss the counter line is allocated and fetched from DRAM; the current transaction
+         * waits for it before its blocks can be decrypted.
+         */
+        void fetch_counter(Addr_t block_addr);
+
+        /**
+         * @brief Increments the counter of a data block being written back.
+         * Dirty evictions and, for split counters, the re-encryption of the blocks
+         * sharing an overflowed line are queued as extra memory traffic.
+         */
+        void update_counter(Addr_t block_addr);
+
+        /**
+         * @brief Maps a block seen for the first time to a random leaf and places it on its path.
+         */
+        void init_block(Addr_t block_id);
+
+        /**
+         * @brief Selects the next transaction if none is currently active.
+         *
+         * If there is no current transaction in progress (`curr_transaction == nullptr`), the arbiter
+         * chooses a source among those with pending transactions and its front transaction is
+         * moved out of the queue for processing.
+         *
+         * @return `true` if a transaction is selected or already active, `false` if no transaction is pending.
+         */
+        bool select_next_transaction();
+
+        /**
+         * @brief Moves the current transaction to the next phase, accounting the time spent in the current one.
+         */
+        void set_phase(Phase next_phase);
+
+        /**
+         * @brief Writes the phase being left by the current transaction to the timeline, if traced.
+         */
+        void trace_phase();
+
+        /**
+         * @brief Makes a dummy transaction on a random leaf the current transaction.
+         * A dummy access reads and writes back a whole path like a real one, but has no
+         * target block and does not reply to the LLC.
+         */
+        void generate_dummy_transaction();
+
+        /**
+         * @brief In adaptive mode, at the end of each epoch selects among the public access
+         * intervals the slowest one that still serves the requests arrived during the epoch.
+         */
+        void update_access_rate();
+
+        /**
+         * @brief Records the stash occupancy at the end of an eviction, then refreshes its
+         * percentiles and the tail fit with the extrapolated overflow probabilities.
+         */
+        void update_stash_statistics();
+
+        /**
+         * @brief Processes any pending read requests in the queue.
+         *        If a request is ready and the controller accepts it, it is removed from the queue.
+         */
+        void process_pending_reads();
+
+        /**
+         * @brief Processes any pending writeback requests in the queue.
+         *        If a request is ready and the controller accepts it, it is sent and removed from the queue.
+         */
+        void process_pending_writes();
+
+        /**
+         * @brief Buffers a writeback request. With the write-drain stage enabled the request
+         * is held in the drain buffer until the whole path has been written back.
+         */
+        void enqueue_writeback(Request& req, Clk_t encrypt_cycle);
+
+        /**
+         * @brief Releases the batched writebacks of the path to the write queue.
+         * The writes are grouped per channel and sorted by bank and row, then the channels are
+         * interleaved so that each DRAM Controller receives a burst of row-ordered writes.
+         */
+        void flush_write_drain();
+
+        /**
+         * @brief Counts how many times a bank has to switch row to serve the writes in the given order.
+         */
+        size_t count_row_switches(const std::vector<WriteRequest>& writes);
+
+        /**
+         * @brief Accounts a request rejected by its DRAM Controller to the channel and request type.
+         */
+        void record_queue_stall(Request& req);
+
+        /**
+         * @brief Accounts a request accepted by a DRAM Controller to its channel and to the traffic of its kind.
+         */
+        void account_request(int channel_idx, const Request& req);
+
+        /**
+         * @brief Processes any pending counter request (fetch, eviction or re-encryption) in the queue.
+         */
+        void process_pending_counters();
+
+        /**
+         * @brief Handles the phase where headers are being read from the ORAM tree.
+         *        Requests are generated based on the transaction’s target leaf.
+         *        Finally, the requests are buffered into the read queue.
+         */
+        void handle_reading_headers();
+
+        /**
+         * @brief Handles the phase where actual data blocks are being read.
+         *        Requests are generated and callbacks attached for processing read completions.
+         *        Finally, the requests are buffered into the read queue.
+         */
+        void handle_reading_data();
+
+        /**
+         * @brief Handles the phase where it has to wait the blocks to be read.
+         */
+        void handle_waiting_reads();
+
+        /**
+         * @brief Answers the LLC with the target block of the current transaction and accounts the reply latency.
+         */
+        void reply_to_frontend();
+
+        /**
+         * @brief Early-reply mode: answers the LLC as soon as the target block is decrypted (and verified,
+         * as the normal reply), while the rest of the path is still being read. The reads keep their order.
+         * A target found in the stash is answered at once: it does not depend on the path being read.
+         */
+        void try_early_reply();
+
+        /**
+         * @brief Speculative reply: lets the current path through before its verification if the
+         * verification window has room. The path is recorded until the Integrity Controller checks it.
+         * @return Whether the path can proceed (it is verified or it is within the window).
+         */
+        bool release_unverified();
+
+        /**
+         * @brief After the reading phase, return the request block to the LLC.
+         *        It should be in the stash.
+         */
+        void handle_reply_block();
+        
+        /**
+         * @brief Handles the writing phase by selecting blocks from the stash and issuing write requests
+         *        if a valid location on the path is available.
+         *        The requests are buffered into the write queue.
+         */
+        void handle_writing_phase();
+        void handle_writing_dummy();
+
+        /**
+         * @brief Finalizes the current transaction after all writebacks are completed.
+         *        Releases the transaction.
+         */
+        void handle_waiting_writes_done();
+
+    public:
+        ORAMController();
+
+        /**
+         * @brief Enables the fixed-rate (timing-channel protected) access mode.
+         * An ORAM access is started every `access_interval` cycles; if no request is pending
+         * a dummy access is performed instead.
+         * @param access_interval Cycles between the start of two accesses. 0 keeps the on-demand mode.
+         * @param adaptive_intervals Public intervals to switch among at each epoch. Empty for a fixed rate.
+         * @param rate_epoch_length Length of an epoch in cycles.
+         */
+        void set_access_rate(Clk_t access_interval, std::vector<Clk_t> adaptive_intervals, Clk_t rate_epoch_length);
+
+        /**
+         * @brief Sets the targets of the stash overflow estimation. Must be called before `set_metrics`.
+         * @param candidate_sizes Stash sizes whose overflow probability (log2) is extrapolated.
+         * @param lambdas Security parameters: the stash size giving a 2^-lambda overflow probability is extrapolated.
+         */
+        void set_stash_targets(std::vector<int> candidate_sizes, std::vector<int> lambdas);
+
+        /**
+         * @brief Enables the per-level bucket occupancy statistics, sampled every `period` evictions
+         * (0 disables them). Must be called after `attach_oram_info` and before `set_counters`.
+         */
+        void set_bucket_stats_period(int period);
+
+        /**
+         * @brief Enables the early reply: the LLC is answered as soon as the target block has been read
+         * and decrypted; the rest of the path read, the remap and the writeback continue in the background.
+         */
+        void set_early_reply(bool enabled) { early_reply = enabled; }
+
+        /**
+         * @brief Sets the function called once the block of a transaction has been remapped. Unlike the
+         * reply to the LLC, which can come earlier, the block is then in the stash until the writeback starts.
+         */
+        void set_remap_callback(std::function<void(Addr_t)> callback) { remap_callback = callback; }
+
+        /**
+         * @brief Enables the speculative reply: the data are returned before the integrity check of the path,
+         * which completes asynchronously, with at most `window` paths outstanding unverified (0 disables it).
+         * The Integrity Controller must signal once per path, in order (a hashing delay > 0).
+         */
+        void set_verification_window(size_t window) { verification_window = window; }
+
+        /**
+         * @brief Bounds the transaction table to `size` entries (0 for an unbounded table): when it
+         * is full `send` refuses the requests. Must be called before any request is sent.
+         */
+        void set_transaction_table_size(size_t size);
+
+        /**
+         * @brief Sets the number of request sources and the arbitration among them.
+         * Must be called before `set_counters` and before any request is sent.
+         * @param num_sources Requests come from sources 0..num_sources-1 (a negative `source_id` is source 0).
+         * @param policy Arbitration policy of the SourceArbiter.
+         * @param weights Per-source weights of the Weighted policy (empty for equal weights).
+         */
+        void set_sources(int num_sources, const std::string& policy, std::vector<int> weights);
+
+        /**
+         * @brief Sets the bytes moved by one DRAM request (the transaction size of the DRAM).
+         */
+        void set_request_bytes(int bytes);
+
+        /**
+         * @brief Maps the partition's region onto its own channels. The global mapper spreads the region
+         * over all the channels: it is mapped as if it started at address 0, the channel is reduced modulo
+         * the partition's channels and the quotient selects one of `fold` slices of the rows.
+         * @param fold Number of partitions.
+         * @param row_level Index of the row in the address vector.
+         * @param num_rows Rows of a bank (a multiple of `fold`).
+         */
+        void set_channel_folding(int fold, int row_level, int num_rows);
+
+        /**
+         * @brief Returns the bytes read and written in DRAM since the last reset of the counters.
+         */
+        size_t get_traffic_bytes() const { return total_read_bytes + total_write_bytes; }
+
+        /**
+         * @brief Returns the number of requests served to the frontend since the last reset of the counters.
+         */
+        size_t get_replies() const { return replies; }
+
+        ORAMController(int stash_size, Clk_t encrypt_delay, Clk_t decrypt_delay, IAddrMapper* m_addr_mapper,
+                              std::vector<IDRAMController*> m_controllers, bool writeback_drain = false);
+        
+        /**
+         * @brief  Advances the ORAM controller simulation by one clock cycle.
+         * @details 
+         * This method updates the internal state of the ORAM controller 
+         * and processes any scheduled operations for the current cycle.
+         */
+        void tick() override;
+
+        /**
+         * @brief  Sends a request to the ORAM controller.
+         * @details 
+         * This method handles an incoming request (e.g., read or write) from the CPU
+         * and returns whether the request was successfully buffered or processed.
+         * @return true if the request was accepted, false if the transaction table is full.
+         */
+        bool send(Request req) override;
+
+        void functional_access(Addr_t block_id) override;
+
+        bool is_idle() override;
+
+        void connect_integrity_controller(IIntegrityController* integrity_controller) override;
+
+        void integrity_check(Addr_t addr) override;
+
+        /**
+         * @brief Removes the block from the stash and the position map.
+         * @return `false` if the block is not in the stash (it cannot be migrated now).
+         */
+        bool migrate_out(Addr_t block_id) override;
+
+        /**
+         * @brief Assigns a random leaf to the block and queues it for the stash, which it enters before
+         * the next transaction is selected; it will be evicted to the tree by the next writebacks.
+         */
+        void migrate_in(Addr_t block_id) override;
+
+        /**
+         * @brief Checks that the stash, with the blocks already queued, has room for one more block.
+         */
+        bool can_migrate_in() override;
+
+        /**
+         * @brief Moves the queued migrated blocks into the stash. Called only between two transactions.
+         */
+        void admit_incoming_blocks();
+
+        void attach_oram_info(const ORAMTreeInfo* oram_tree_info) override;
+
+        void attach_counter_cache(ICounterCache* counter_cache) override;
+
+        void attach_tracer(TimelineTracer* tracer, int pid) override;
+
+        /**
+         * @brief  Attach the PathORAM's access counter to ORAMCounter.
+         */
+        void set_counters(std::map<std::string, size_t&>& counters) override;
+
+        /**
+         * @brief  Attach the PathORAM's derived metrics to ORAMCounter.
+         */
+        void set_metrics(std::map<std::string, float&>& metrics) override;
+
+        void reset_stats() override;
+
+        int get_stash_size() override;
+};
+
+
+}
+
 #endif   // ORAM_BACKEND_H
\ No newline at end of file
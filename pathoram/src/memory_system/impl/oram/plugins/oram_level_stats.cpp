@@ -0,0 +1,132 @@
+#include <map>
+#include <vector>
+
+#include "base/base.h"
+#include "dram_controller/controller.h"
+#include "dram_controller/plugin.h"
+
+#include "memory_system/impl/oram/components/inc/oram_request_tag.h"
+
+namespace Ramulator {
+
+/**
+ * @class ORAMLevelStats
+ * @brief DRAM Controller plugin that aggregates the requests generated by the ORAM Controller
+ * per tree level and per request kind (see `ORAMRequestTag`).
+ *
+ * A request is classified when its first command is issued: a row hit if it is the final command,
+ * a row miss if it opens a row, a row conflict if it closes one. A row conflict is also a
+ * cross-level conflict when the row being closed was opened for a request of another tree level.
+ * The latency of a request goes from its arrival in the DRAM Controller to the data return
+ * (reads) or to the issue of the write command (writes).
+ */
+class ORAMLevelStats : public IControllerPlugin, public Implementation {
+  RAMULATOR_REGISTER_IMPLEMENTATION(IControllerPlugin, ORAMLevelStats, "ORAMLevelStats", "Per-tree-level statistics of the ORAM requests.")
+
+  private:
+    struct AccessStats {
+      size_t requests = 0;
+      size_t latency = 0;
+      size_t row_hits = 0;
+      size_t row_misses = 0;
+      size_t row_conflicts = 0;
+      size_t cross_level_conflicts = 0;
+    };
+
+    IDRAM* m_dram = nullptr;
+    int m_bank_level = -1;
+
+    // std::map keeps the references handed to register_stat valid when a new level shows up
+    std::map<int, AccessStats> level_stats;
+    std::vector<AccessStats> kind_stats;
+
+    // Tree level of the request that opened the row currently open in each bank
+    std::map<AddrVec_t, int> open_row_level;
+
+    void register_access_stats(AccessStats& stats, const std::string& prefix) {
+      register_stat(stats.requests).name("{}_requests_{}", prefix, m_ctrl->m_channel_id);
+      register_stat(stats.latency).name("{}_latency_{}", prefix, m_ctrl->m_channel_id);
+      register_stat(stats.row_hits).name("{}_row_hits_{}", prefix, m_ctrl->m_channel_id);
+      register_stat(stats.row_misses).name("{}_row_misses_{}", prefix, m_ctrl->m_channel_id);
+      register_stat(stats.row_conflicts).name("{}_row_conflicts_{}", prefix, m_ctrl->m_channel_id);
+      register_stat(stats.cross_level_conflicts).name("{}_cross_level_conflicts_{}", prefix, m_ctrl->m_channel_id);
+    }
+
+    AccessStats* get_level_stats(int level) {
+      if(level < 0) return nullptr;
+      auto it = level_stats.find(level);
+      if(it == level_stats.end()) {
+        it = level_stats.emplace(level, AccessStats()).first;
+        register_access_stats(it->second, fmt::format("oram_level{}", level));
+      }
+      return &it->second;
+    }
+
+    AddrVec_t get_bank(const AddrVec_t& addr_vec) {
+      return AddrVec_t(addr_vec.begin(), addr_vec.begin() + m_bank_level + 1);
+    }
+
+  public:
+    void init() override { };
+
+    void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {
+      m_ctrl = cast_parent<IDRAMController>();
+      m_dram = m_ctrl->m_dram;
+      m_bank_level = m_dram->m_levels("bank");
+      kind_stats.resize(ORAMRequestTag::num_kinds);
+      for(int k = 1; k < ORAMRequestTag::num_kinds; k++) {
+        register_access_stats(kind_stats[k], fmt::format("oram_{}", ORAMRequestTag::name(static_cast<ORAMRequestKind>(k))));
+      }
+    };
+
+    void update(bool request_found, ReqBuffer::iterator& req_it) override {
+      m_clk++;
+      if(!request_found) return;
+
+      ORAMRequestKind kind = ORAMRequestTag::kind(*req_it);
+      if(kind == ORAMRequestKind::Unknown) return;
+      int level = ORAMRequestTag::level(*req_it);
+      AccessStats* level_entry = get_level_stats(level);
+      AccessStats& kind_entry = kind_stats[static_cast<int>(kind)];
+
+      int command = req_it->command;
+      const auto& meta = m_dram->m_command_meta(command);
+
+      // Classify the request on its first command
+      if(req_it->scratchpad[ORAMRequestTag::user_slot] == 0) {
+        req_it->scratchpad[ORAMRequestTag::user_slot] = 1;
+        bool cross_level = false;
+        size_t AccessStats::* outcome = &AccessStats::row_hits;
+        if(command != req_it->final_command && meta.is_closing) {
+          outcome = &AccessStats::row_conflicts;
+          auto it = open_row_level.find(get_bank(req_it->addr_vec));
+          cross_level = it != open_row_level.end() && it->second != level;
+        } else if(command != req_it->final_command && meta.is_opening) {
+          outcome = &AccessStats::row_misses;
+        }
+        for(AccessStats* stats : {level_entry, &kind_entry}) {
+          if(stats == nullptr) continue;
+          stats->requests++;
+          stats->*outcome += 1;
+          stats->cross_level_conflicts += cross_level;
+        }
+      }
+
+      if(meta.is_opening) {
+        open_row_level[get_bank(req_it->addr_vec)] = level;
+      }
+
+      if(command == req_it->final_command) {
+        Clk_t completion = m_clk;
+        if(req_it->type_id == Request::Type::Read) {
+          completion += m_dram->m_read_latency;
+        }
+        for(AccessStats* stats : {level_entry, &kind_entry}) {
+          if(stats == nullptr) continue;
+          stats->latency += completion - req_it->arrive;
+        }
+      }
+    };
+};
+
+}   // namespace Ramulator
\ No newline at end of file
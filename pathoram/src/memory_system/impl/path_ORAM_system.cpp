@@ -1,156 +1,654 @@
-#include <string>
-#include <map>
-
-#include "memory_system/memory_system.h"
-#include "translation/translation.h"
-#include "dram_controller/controller.h"
-#include "addr_mapper/addr_mapper.h"
-#include "dram/dram.h"
-
-#include "memory_system/impl/oram/components/interfaces/ioram_controller.h"
-#include "memory_system/impl/oram/components/interfaces/iintegrity_controller.h"
-
-#include "memory_system/impl/oram/oram_controller.h"
-#include "memory_system/impl/oram/components/inc/integrity_controller.h"
-
-#include "memory_system/impl/oram/components/inc/oram_tree_info.h"
-
-#define LOG_REQS 0
-
-namespace Ramulator {
-
-class PathORAMSystem final : public IMemorySystem, public Implementation {
-  RAMULATOR_REGISTER_IMPLEMENTATION(IMemorySystem, PathORAMSystem, "PathORAM", "A PathORAM-based memory system.");
-
-  private:
-    IORAMController* oram_controller;
-    IIntegrityController* integrity_controller;
-    ORAMTreeInfo* oram_tree_info;
-
-  protected:
-    Clk_t m_clk = 0;
-    IDRAM* m_dram;
-    IAddrMapper* m_addr_mapper;
-    std::vector<IDRAMController*> m_controllers;
-
-  public:
-    std::map<std::string, size_t&> pathoram_counters;
-
-    int s_num_read_requests = 0;
-    int s_num_write_requests = 0;
-    int s_num_other_requests = 0;
-
-  public:
-    void init() override {
-      // Create device (a top-level node wrapping all channel nodes)
-      m_dram = create_child_ifce<IDRAM>();
-      m_addr_mapper = create_child_ifce<IAddrMapper>();
-
-      int num_channels = m_dram->get_level_size("channel");   
-
-      // Create memory controllers
-      for (int i = 0; i < num_channels; i++) {
-        IDRAMController* controller = create_child_ifce<IDRAMController>();
-        controller->m_impl->set_id(fmt::format("Channel {}", i));
-        controller->m_channel_id = i;
-        m_controllers.push_back(controller);
-      }
-
-      m_clock_ratio = param<uint>("clock_ratio").required();
-
-      register_stat(m_clk).name("memory_system_cycles");
-      register_stat(s_num_read_requests).name("total_num_read_requests");
-      register_stat(s_num_write_requests).name("total_num_write_requests");
-      register_stat(s_num_other_requests).name("total_num_other_requests");
-
-      //PathORAM    
-      Addr_t base_address_tree = param<Addr_t>("base_address_tree").desc("Base address of the ORAM Tree in DRAM memory.").required();
-      Addr_t length_tree = param<Addr_t>("length_tree").desc("Length of ORAM Tree in DRAM memory.").required();
-      int block_size  = param<uint32_t>("block_size").desc("Size of a block in Bytes.").default_val(64);
-      int z_blocks = param<uint32_t>("z_blocks").desc("Number of blocks in a bucket.").default_val(4);
-      int arity = param<int>("arity").desc("Arity of ORAM Tree.").default_val(2);
-      int stash_size = param<uint32_t>("stash_size").desc("Stash's max capacity.").default_val(8192);
-      Clk_t encrypt_delay = param<uint>("encrypt_delay").desc("Number of clock cycles to encrypt a block.").default_val(0);
-      Clk_t decrypt_delay = param<uint>("decrypt_delay").desc("Number of clock cycles to decrypt a block.").default_val(0);
-      int hash_delay = param<int>("hash_delay").desc("Number of clock cycles to calculate the hash in Integrity Checker component.").default_val(0);
-
-      oram_tree_info = new ORAMTreeInfo(base_address_tree, length_tree, block_size, z_blocks, arity);
-      oram_controller = new ORAMController(stash_size, encrypt_delay, decrypt_delay, m_addr_mapper, m_controllers);
-      integrity_controller = new IntegrityController(hash_delay);
-
-      oram_controller->set_counters(pathoram_counters);
-      integrity_controller->set_counters(pathoram_counters);
-      
-      oram_controller->attach_oram_info(oram_tree_info);
-      integrity_controller->attach_oram_info(oram_tree_info);
-
-      oram_controller->connect_integrity_controller(integrity_controller);
-      integrity_controller->connect_oram_controller(oram_controller);
-
-      for(auto e : pathoram_counters) {
-        register_stat(e.second).name(e.first);
-      }
-
-      char filename[256];
-      std::sprintf(filename, "stash_occupancy_%lu_%d_%d_%d_%d_%lu_%d_%d.csv", length_tree, block_size, z_blocks, arity, stash_size, encrypt_delay, hash_delay, num_channels);
-      static_cast<ORAMController*>(oram_controller)->outdata.open(filename, std::ios::app);
-    };
-
-    void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {}
-
-    bool send(Request req) override {
-      // Send and buffer the requested block in the ORAM Controller
-      bool is_success = oram_controller->send(req);
-
-      if(is_success) {
-        
-        #if LOG_REQS
-        //type_id is 0 for read, 1 for write
-        std::cout<< "Received type_id "<< req.type_id <<" request for "<< req.addr << std::endl;
-        #endif
-
-        switch (req.type_id) {
-          case Request::Type::Read: {
-            s_num_read_requests++;
-            break;
-          }
-          case Request::Type::Write: {
-            s_num_write_requests++;
-            break;
-          }
-          default: {
-            s_num_other_requests++;
-            break;
-          }
-        }
-      }
-      return is_success;
-    };
-
-    void tick() override {
-      m_clk++;
-      m_dram->tick();
-      for (auto controller : m_controllers) {
-        controller->tick();
-      }
-      static_cast<IntegrityController*>(integrity_controller)->tick();
-      static_cast<ORAMController*>(oram_controller)->tick();
-    };
-
-    float get_tCK() override {
-      return m_dram->m_timing_vals("tCK_ps") / 1000.0f;
-    }
-
-    // const SpecDef& get_supported_requests() override {
-    //   return m_dram->m_requests;
-    // };
-
-    ~PathORAMSystem() {
-        delete oram_controller;
-        delete integrity_controller;
-        delete oram_tree_info;
-    }
-};
-  
-}   // namespace 
-
+#include <string>
+#include <map>
+#include <unordered_map>
+#include <fstream>
+
+#include "memory_system/memory_system.h"
+#include "translation/translation.h"
+#include "dram_controller/controller.h"
+#include "addr_mapper/addr_mapper.h"
+#include "dram/dram.h"
+
+#include "memory_system/impl/oram/components/interfaces/ioram_controller.h"
+#include "memory_system/impl/oram/components/interfaces/iintegrity_controller.h"
+
+#include "memory_system/impl/oram/oram_controller.h"
+#include "memory_system/impl/oram/components/inc/integrity_controller.h"
+#include "memory_system/impl/oram/components/inc/counter_cache.h"
+#include "memory_system/impl/oram/components/inc/timeline_tracer.h"
+#include "memory_system/impl/oram/components/inc/host_profiler.h"
+#include "memory_system/impl/oram/components/inc/sampled_simulation.h"
+
+#include "memory_system/impl/oram/components/inc/oram_tree_info.h"
+#include "memory_system/impl/oram/components/inc/random_stream.h"
+
+#define LOG_REQS 0
+
+namespace Ramulator {
+
+class PathORAMSystem final : public IMemorySystem, public Implementation {
+  RAMULATOR_REGISTER_IMPLEMENTATION(IMemorySystem, PathORAMSystem, "PathORAM", "A PathORAM-based memory system.");
+
+  private:
+    // One independent sub-ORAM per partition (channel group)
+    int num_partitions;
+    std::vector<IORAMController*> oram_controllers;
+    std::vector<IIntegrityController*> integrity_controllers;
+    std::vector<ICounterCache*> counter_caches;
+    std::vector<ORAMTreeInfo*> oram_tree_infos;
+    TimelineTracer* tracer = nullptr;
+
+    // Warm-up: the counters are cleared after `warmup_requests` accepted requests or `warmup_cycles` cycles
+    size_t warmup_requests = 0;
+    Clk_t warmup_cycles = 0;
+    bool warmed_up = true;
+    size_t warmup_end_cycle = 0;
+
+    // Epoch snapshots, one JSON object per line every `epoch_cycles` cycles
+    Clk_t epoch_cycles = 0;
+    std::ofstream epoch_file;
+    int burst_cycles = 0;
+    std::map<std::string, size_t> last_snapshot;
+
+    // Traffic report: DRAM bytes moved per useful byte served and fraction of the peak DRAM
+    // bandwidth achieved since the end of the warm-up (refreshed periodically)
+    int block_size = 64;
+    float peak_bytes_per_cycle = 0;
+    float tCK_ns = 0;
+    size_t traffic_total_bytes = 0;
+    size_t traffic_useful_bytes = 0;
+    float bandwidth_amplification = 0;
+    float peak_bandwidth_gbps = 0;
+    float achieved_bandwidth_gbps = 0;
+    float peak_bandwidth_fraction = 0;
+
+    // Sampled simulation: detailed samples, functional fast-forward in between. The replies of the
+    // fast-forwarded requests are delivered at the next tick
+    SampledSimulation sampling;
+    std::vector<Request> fast_forward_replies;
+
+    // Host profiler: host cycles since the first tick (or the end of the warm-up) and simulation speed
+    // (refreshed periodically)
+    size_t profile_start_cycles = 0;
+    float profile_start_seconds = 0;
+    size_t profile_total_cycles = 0;
+    float profile_host_seconds = 0;
+    float profile_cycles_per_host_second = 0;
+
+    // Per-source (core) service over all the partitions since the end of the warm-up (refreshed periodically)
+    int num_sources;
+    std::vector<float> source_throughput;
+    std::vector<float> source_avg_latency;
+
+    // Seed of every random stream of the run
+    size_t rng_seed;
+
+    // Partitions' router
+    RandomStream router_rng;
+    std::unordered_map<Addr_t, int> block_partition;
+    std::unordered_map<Addr_t, int> outstanding_reqs;
+    int migration_period;
+    size_t served_reqs = 0;
+    size_t num_migrations = 0;
+    size_t num_deferred_migrations = 0;
+    size_t num_skipped_migrations = 0;
+
+    /**
+     * @brief Returns the partition that holds the block, assigning a random one on the first access.
+     */
+    int route(Addr_t block_id) {
+      auto it = block_partition.find(block_id);
+      if(it != block_partition.end()) return it->second;
+      int partition = router_rng.uniform(num_partitions);
+      block_partition.insert({block_id, partition});
+      return partition;
+    }
+
+    /**
+     * @brief Called when the block of a request has been remapped by its partition (not at the reply to
+     * the LLC, which can come earlier): the block is in the source stash, so it is migrated at once.
+     * Every `migration_period` served requests (every access by default, as in partitioned ORAM) the
+     * block just accessed moves to a fresh random partition, so that its next access is unlinkable.
+     */
+    void on_remap(Addr_t block_id) {
+      outstanding_reqs[block_id]--;
+      served_reqs++;
+      if(migration_period > 0 && served_reqs % migration_period == 0) {
+        migrate(block_id);
+      }
+    }
+
+    /**
+     * @brief Moves the block from the stash of its partition to the stash of a random one. A block with other
+     * requests already queued in its partition stays there (the remap of the last one migrates it); a block
+     * whose destination stash is full stays too. Both cases are counted: they leak the partition of the next access.
+     */
+    void migrate(Addr_t block_id) {
+      int src = block_partition.at(block_id);
+      int dst = router_rng.uniform(num_partitions);
+      if(outstanding_reqs[block_id] > 0) {
+        num_deferred_migrations++;
+        return;
+      }
+      if(dst != src) {
+        if(!oram_controllers[dst]->can_migrate_in() || !oram_controllers[src]->migrate_out(block_id)) {
+          num_skipped_migrations++;
+          return;
+        }
+        oram_controllers[dst]->migrate_in(block_id);
+        block_partition[block_id] = dst;
+      }
+      num_migrations++;
+    }
+
+    /**
+     * @brief Fast-forwards the request functionally in its partition. Requests are refused while
+     * the memory system drains at the end of a detailed sample.
+     */
+    bool fast_forward(Request& req) {
+      if(sampling.get_mode() == SampledSimulation::Mode::Draining) return false;
+      int partition = num_partitions > 1 ? route(req.addr) : 0;
+      oram_controllers[partition]->functional_access(req.addr);
+      if(req.callback) {
+        fast_forward_replies.push_back(req);
+      }
+      sampling.on_fast_forward_request();
+      return true;
+    }
+
+    /**
+     * @brief Delivers the replies of the fast-forwarded requests and closes the current sample
+     * once every partition has drained.
+     */
+    void update_sampling() {
+      std::vector<Request> replies;
+      replies.swap(fast_forward_replies);
+      for(auto& req : replies) {
+        req.callback(req);
+      }
+      if(sampling.get_mode() != SampledSimulation::Mode::Draining) return;
+      for(auto oram_controller : oram_controllers) {
+        if(!oram_controller->is_idle()) return;
+      }
+      sampling.end_sample(m_clk, sum_counters("oram_controller_replies"), sum_counters("oram_controller_cumulative_latency"));
+    }
+
+    /**
+     * @brief Sums the counter over the partitions (the names only differ by the partition prefix).
+     */
+    size_t sum_counters(const std::string& name) {
+      size_t sum = 0;
+      for(auto& e : pathoram_counters) {
+        if(e.first.size() >= name.size() && e.first.compare(e.first.size() - name.size(), name.size(), name) == 0) {
+          sum += e.second;
+        }
+      }
+      return sum;
+    }
+
+    /**
+     * @brief Ends the warm-up: clears every counter and the state the statistics are computed from.
+     * The derived metrics are refreshed by the components at their next update.
+     */
+    void end_warmup() {
+      warmed_up = true;
+      warmup_end_cycle = m_clk;
+      for(auto& e : pathoram_counters) {
+        e.second = 0;
+      }
+      s_num_read_requests = 0;
+      s_num_write_requests = 0;
+      s_num_other_requests = 0;
+      served_reqs = 0;
+      for(auto oram_controller : oram_controllers) {
+        oram_controller->reset_stats();
+      }
+      // The profile_*_cycles counters have just been cleared: measure the total from here too
+      #if PATHORAM_PROFILE
+      profile_start_cycles = HostProfiler::now();
+      profile_start_seconds = HostProfiler::elapsed_seconds();
+      #endif
+      last_snapshot.clear();
+      if(epoch_file.is_open()) {
+        epoch_file << fmt::format("{{\"cycle\":{},\"event\":\"warmup_end\"}}", m_clk) << std::endl;
+      }
+    }
+
+    /**
+     * @brief Writes the epoch snapshot: the time series fields (throughput, average reply latency,
+     * stash size and channel utilisation over the epoch) followed by all the cumulative counters.
+     */
+    void write_epoch_snapshot() {
+      auto delta = [this](const std::string& name) {
+        size_t value = sum_counters(name);
+        size_t previous = last_snapshot.count(name) ? last_snapshot[name] : 0;
+        last_snapshot[name] = value;
+        return value - previous;
+      };
+
+      size_t replies = delta("oram_controller_replies");
+      size_t latency = delta("oram_controller_cumulative_latency");
+      std::string stash_sizes;
+      for(int p = 0; p < num_partitions; p++) {
+        stash_sizes += fmt::format("{}{}", p > 0 ? "," : "", oram_controllers[p]->get_stash_size());
+      }
+      std::string utilisation;
+      for(size_t c = 0; c < m_controllers.size(); c++) {
+        size_t requests = delta(fmt::format("oram_controller_ch{}_requests", m_controllers[c]->m_channel_id));
+        utilisation += fmt::format("{}{:.4f}", c > 0 ? "," : "", (float)(requests * burst_cycles) / epoch_cycles);
+      }
+      std::string counters;
+      for(auto& e : pathoram_counters) {
+        counters += fmt::format("{}\"{}\":{}", counters.empty() ? "" : ",", e.first, e.second);
+      }
+
+      epoch_file << fmt::format("{{\"cycle\":{},\"throughput\":{:.6f},\"avg_latency\":{:.2f},\"stash_size\":[{}],\"channel_utilisation\":[{}],\"counters\":{{{}}}}}",
+                                m_clk, (float)replies / epoch_cycles, replies > 0 ? (float)latency / replies : 0.0f,
+                                stash_sizes, utilisation, counters) << std::endl;
+    }
+
+    /**
+     * @brief Refreshes the traffic report.
+     */
+    void update_traffic_report() {
+      traffic_total_bytes = 0;
+      traffic_useful_bytes = 0;
+      for(auto oram_controller : oram_controllers) {
+        traffic_total_bytes += static_cast<ORAMController*>(oram_controller)->get_traffic_bytes();
+        traffic_useful_bytes += static_cast<ORAMController*>(oram_controller)->get_replies() * block_size;
+      }
+      Clk_t cycles = m_clk - warmup_end_cycle;
+      bandwidth_amplification = traffic_useful_bytes > 0 ? (float)traffic_total_bytes / traffic_useful_bytes : 0;
+      achieved_bandwidth_gbps = cycles > 0 ? traffic_total_bytes / (cycles * tCK_ns) : 0;
+      peak_bandwidth_fraction = cycles > 0 ? traffic_total_bytes / (cycles * peak_bytes_per_cycle) : 0;
+    }
+
+    /**
+     * @brief Refreshes the per-source throughput (replies per cycle) and average latency.
+     */
+    void update_source_report() {
+      Clk_t cycles = m_clk - warmup_end_cycle;
+      for(int s = 0; s < num_sources; s++) {
+        size_t replies = sum_counters(fmt::format("oram_controller_source{}_replies", s));
+        size_t latency = sum_counters(fmt::format("oram_controller_source{}_cumulative_latency", s));
+        source_throughput[s] = cycles > 0 ? (float)replies / cycles : 0;
+        source_avg_latency[s] = replies > 0 ? (float)latency / replies : 0;
+      }
+    }
+
+    /**
+     * @brief Refreshes the host cycles and the simulation speed since the start (or the end of the warm-up).
+     */
+    void update_profile_report() {
+      profile_total_cycles = HostProfiler::now() - profile_start_cycles;
+      profile_host_seconds = HostProfiler::elapsed_seconds() - profile_start_seconds;
+      profile_cycles_per_host_second = profile_host_seconds > 0 ? (m_clk - warmup_end_cycle) / profile_host_seconds : 0;
+    }
+
+    /**
+     * @brief Registers the counters of a partition. With more than one partition
+     * the names are prefixed with the partition index.
+     */
+    void add_partition_counters(int partition, std::map<std::string, size_t&>& counters, std::map<std::string, float&>& metrics) {
+      std::string prefix = num_partitions > 1 ? fmt::format("partition{}_", partition) : "";
+      for(auto e : counters) {
+        pathoram_counters.insert({prefix + e.first, e.second});
+      }
+      for(auto e : metrics) {
+        pathoram_metrics.insert({prefix + e.first, e.second});
+      }
+    }
+
+  protected:
+    Clk_t m_clk = 0;
+    IDRAM* m_dram;
+    IAddrMapper* m_addr_mapper;
+    std::vector<IDRAMController*> m_controllers;
+
+  public:
+    std::map<std::string, size_t&> pathoram_counters;
+    std::map<std::string, float&> pathoram_metrics;
+
+    int s_num_read_requests = 0;
+    int s_num_write_requests = 0;
+    int s_num_other_requests = 0;
+
+  public:
+    void init() override {
+      // Create device (a top-level node wrapping all channel nodes)
+      m_dram = create_child_ifce<IDRAM>();
+      m_addr_mapper = create_child_ifce<IAddrMapper>();
+
+      int num_channels = m_dram->get_level_size("channel");   
+
+      // Create memory controllers
+      for (int i = 0; i < num_channels; i++) {
+        IDRAMController* controller = create_child_ifce<IDRAMController>();
+        controller->m_impl->set_id(fmt::format("Channel {}", i));
+        controller->m_channel_id = i;
+        m_controllers.push_back(controller);
+      }
+
+      m_clock_ratio = param<uint>("clock_ratio").required();
+
+      register_stat(m_clk).name("memory_system_cycles");
+      register_stat(s_num_read_requests).name("total_num_read_requests");
+      register_stat(s_num_write_requests).name("total_num_write_requests");
+      register_stat(s_num_other_requests).name("total_num_other_requests");
+
+      //PathORAM    
+      Addr_t base_address_tree = param<Addr_t>("base_address_tree").desc("Base address of the ORAM Tree in DRAM memory.").required();
+      Addr_t length_tree = param<Addr_t>("length_tree").desc("Length of ORAM Tree in DRAM memory.").required();
+      block_size  = param<uint32_t>("block_size").desc("Size of a block in Bytes.").default_val(64);
+      int z_blocks = param<uint32_t>("z_blocks").desc("Number of blocks in a bucket.").default_val(4);
+      int arity = param<int>("arity").desc("Arity of ORAM Tree.").default_val(2);
+      int stash_size = param<uint32_t>("stash_size").desc("Stash's max capacity.").default_val(8192);
+      Clk_t encrypt_delay = param<uint>("encrypt_delay").desc("Number of clock cycles to encrypt a block.").default_val(0);
+      Clk_t decrypt_delay = param<uint>("decrypt_delay").desc("Number of clock cycles to decrypt a block.").default_val(0);
+      int hash_delay = param<int>("hash_delay").desc("Number of clock cycles to calculate the hash in Integrity Checker component.").default_val(0);
+      std::string counter_mode = param<std::string>("counter_mode").desc("Organization of the encryption counters (None, Monolithic, Split).").default_val("None");
+      int counter_cache_size = param<int>("counter_cache_size").desc("Size of the Counter Cache in Bytes.").default_val(32768);
+      int counter_cache_ways = param<int>("counter_cache_ways").desc("Associativity of the Counter Cache.").default_val(8);
+      bool writeback_drain = param<bool>("writeback_drain").desc("Batch the writebacks of a path and release them grouped by channel, bank and row.").default_val(false);
+      Clk_t access_interval = param<uint>("access_interval").desc("Fixed-rate mode: clock cycles between two ORAM accesses (0 for on-demand accesses).").default_val(0);
+      std::vector<int> adaptive_intervals = param<std::vector<int>>("adaptive_intervals").desc("Adaptive fixed-rate mode: public access intervals selected at each epoch.").default_val(std::vector<int>());
+      Clk_t rate_epoch = param<uint>("rate_epoch").desc("Adaptive fixed-rate mode: length of an epoch in clock cycles.").default_val(1 << 20);
+      num_partitions = param<int>("num_partitions").desc("Number of independent sub-ORAMs, each one on its own group of channels.").default_val(1);
+      std::vector<int> stash_candidate_sizes = param<std::vector<int>>("stash_candidate_sizes").desc("Stash sizes whose overflow probability is extrapolated from the occupancy tail.").default_val(std::vector<int>{32, 64, 128, 256});
+      std::vector<int> stash_overflow_lambdas = param<std::vector<int>>("stash_overflow_lambdas").desc("Security parameters: the stash size with a 2^-lambda overflow probability is extrapolated.").default_val(std::vector<int>{20, 40, 80, 128});
+      int bucket_stats_period = param<int>("bucket_stats_period").desc("Number of evictions between two samples of the per-level bucket occupancy (0 disables it).").default_val(64);
+      int stash_trace_sampling = param<int>("stash_trace_sampling").desc("Record the stash occupancy every N transactions (0 disables the trace).").default_val(1);
+      bool stash_trace_async = param<bool>("stash_trace_async").desc("Write the stash occupancy trace from a background thread.").default_val(false);
+      std::string timeline_trace = param<std::string>("timeline_trace").desc("Chrome trace-event JSON file of the ORAM timeline (empty disables the trace).").default_val("");
+      Clk_t timeline_start = param<uint>("timeline_start").desc("First clock cycle written to the timeline trace.").default_val(0);
+      Clk_t timeline_end = param<uint>("timeline_end").desc("Last clock cycle written to the timeline trace.").default_val(100000);
+      int timeline_sampling = param<int>("timeline_sampling").desc("Trace one ORAM transaction every N in the timeline.").default_val(1);
+      warmup_requests = param<uint>("warmup_requests").desc("Number of accepted requests after which all the counters are cleared (0 disables).").default_val(0);
+      warmup_cycles = param<uint>("warmup_cycles").desc("Number of cycles after which all the counters are cleared (0 disables).").default_val(0);
+      epoch_cycles = param<uint>("epoch_cycles").desc("Length in cycles of an epoch of the statistics time series (0 disables).").default_val(0);
+      std::string epoch_stats_file = param<std::string>("epoch_stats_file").desc("JSON Lines file of the epoch snapshots.").default_val("epoch_stats.jsonl");
+      size_t sampling_period = param<uint>("sampling_period").desc("Requests in a sampling unit: one detailed sample, the rest fast-forwarded (0 simulates every request in detail).").default_val(0);
+      size_t sampling_length = param<uint>("sampling_length").desc("Measured requests of each detailed sample.").default_val(10000);
+      size_t sampling_warmup = param<uint>("sampling_warmup").desc("Detailed requests before the measurement of each sample.").default_val(1000);
+      bool early_reply = param<bool>("early_reply").desc("Reply to the LLC as soon as the target block is read and decrypted, finishing the path read, remap and writeback in the background.").default_val(false);
+      size_t verification_window = param<uint>("verification_window").desc("Speculative reply: paths whose data can be returned before their integrity check completes (0 keeps the check on the reply path).").default_val(0);
+      size_t transaction_table_size = param<uint>("transaction_table_size").desc("Entries of the transaction table of each ORAM Controller: when it is full the requests are refused (0 for an unbounded table).").default_val(0);
+      num_sources = param<int>("num_sources").desc("Number of request sources (cores, by req.source_id), each with its own transaction queue.").default_val(1);
+      std::string arbitration = param<std::string>("arbitration").desc("Arbitration among the sources' queues (OldestFirst, RoundRobin, Weighted).").default_val("OldestFirst");
+      std::vector<int> source_weights = param<std::vector<int>>("source_weights").desc("Weighted arbitration: one weight per source (empty for equal weights).").default_val(std::vector<int>());
+      rng_seed = param<uint64_t>("seed").desc("Seed of the random leaves, placements and routing: a run is replayed bit-exactly from its seed (0 draws a random one, reported as rng_seed).").default_val(0);
+      migration_period = param<int>("migration_period").desc("Number of served requests between two migrations of the accessed block to a random partition (1 migrates after every access, as partitioned ORAM; larger values or 0 let repeated accesses be linked).").default_val(1);
+
+      if(num_sources < 1) {
+        throw std::runtime_error(fmt::format("The number of sources ({}) must be at least 1.", num_sources));
+      }
+      if(num_partitions < 1 || num_partitions > num_channels || num_channels % num_partitions != 0) {
+        throw std::runtime_error(fmt::format("The number of partitions ({}) must divide the number of channels ({}).", num_partitions, num_channels));
+      }
+      if(rng_seed == 0) rng_seed = RandomStream::random_seed();
+      router_rng = RandomStream(rng_seed, RandomStream::stream_id(RandomStream::Router, 0));
+
+      warmed_up = warmup_requests == 0 && warmup_cycles == 0;
+      sampling = SampledSimulation(sampling_period, sampling_length, sampling_warmup);
+      if(epoch_cycles > 0) {
+        epoch_file.open(epoch_stats_file, std::ios::trunc);
+        if(!epoch_file.is_open()) throw std::runtime_error(fmt::format("Cannot open the epoch statistics file {}", epoch_stats_file));
+        burst_cycles = m_dram->m_timing_vals("nBL");
+      }
+
+      // A DRAM request moves one transaction (prefetch * channel width) in nBL cycles on each channel
+      int request_bytes = m_dram->m_internal_prefetch_size * m_dram->m_channel_width / 8;
+      tCK_ns = m_dram->m_timing_vals("tCK_ps") / 1000.0f;
+      peak_bytes_per_cycle = num_channels * request_bytes / (float)m_dram->m_timing_vals("nBL");
+      peak_bandwidth_gbps = peak_bytes_per_cycle / tCK_ns;
+
+      if(!timeline_trace.empty()) {
+        tracer = new TimelineTracer(timeline_trace, timeline_start, timeline_end, timeline_sampling);
+      }
+
+      int channels_per_partition = num_channels / num_partitions;
+      Addr_t partition_length = length_tree / num_partitions;
+      for(int p = 0; p < num_partitions; p++) {
+        std::vector<IDRAMController*> partition_controllers(m_controllers.begin() + p * channels_per_partition,
+                                                            m_controllers.begin() + (p + 1) * channels_per_partition);
+        ORAMTreeInfo* oram_tree_info = new ORAMTreeInfo(base_address_tree + p * partition_length, partition_length, block_size, z_blocks, arity, CounterCache::blocks_per_line(counter_mode));
+        oram_tree_info->seed_rng(rng_seed, p);
+        IORAMController* oram_controller = new ORAMController(stash_size, encrypt_delay, decrypt_delay, m_addr_mapper, partition_controllers, writeback_drain);
+        IIntegrityController* integrity_controller = new IntegrityController(hash_delay);
+        ICounterCache* counter_cache = nullptr;
+        if(counter_mode != "None") {
+          counter_cache = new CounterCache(counter_mode, counter_cache_size, counter_cache_ways);
+        }
+
+        // The tree info comes first: the per-level counters are sized on it
+        oram_controller->attach_oram_info(oram_tree_info);
+        integrity_controller->attach_oram_info(oram_tree_info);
+
+        std::map<std::string, size_t&> counters;
+        std::map<std::string, float&> metrics;
+        static_cast<ORAMController*>(oram_controller)->set_access_rate(access_interval, std::vector<Clk_t>(adaptive_intervals.begin(), adaptive_intervals.end()), rate_epoch);
+        static_cast<ORAMController*>(oram_controller)->set_stash_targets(stash_candidate_sizes, stash_overflow_lambdas);
+        static_cast<ORAMController*>(oram_controller)->set_bucket_stats_period(bucket_stats_period);
+        static_cast<ORAMController*>(oram_controller)->set_request_bytes(request_bytes);
+        if(num_partitions > 1) {
+          int row_level = m_dram->m_levels("row");
+          static_cast<ORAMController*>(oram_controller)->set_channel_folding(num_partitions, row_level, m_dram->m_organization.count[row_level]);
+        }
+        static_cast<ORAMController*>(oram_controller)->set_transaction_table_size(transaction_table_size);
+        static_cast<ORAMController*>(oram_controller)->set_early_reply(early_reply);
+        // Without a hashing delay every block is verified on arrival (one signal per block, not per path):
+        // there is nothing to speculate on
+        static_cast<ORAMController*>(oram_controller)->set_verification_window(hash_delay > 0 ? verification_window : 0);
+        static_cast<ORAMController*>(oram_controller)->set_sources(num_sources, arbitration, source_weights);
+        if(num_partitions > 1) {
+          static_cast<ORAMController*>(oram_controller)->set_remap_callback([this](Addr_t block_id) { this->on_remap(block_id); });
+        }
+        oram_controller->set_counters(counters);
+        oram_controller->set_metrics(metrics);
+        integrity_controller->set_counters(counters);
+
+        if(counter_cache != nullptr) {
+          counter_cache->set_counters(counters);
+          counter_cache->set_metrics(metrics);
+          counter_cache->attach_oram_info(oram_tree_info);
+          oram_controller->attach_counter_cache(counter_cache);
+        }
+
+        oram_controller->connect_integrity_controller(integrity_controller);
+        integrity_controller->connect_oram_controller(oram_controller);
+        add_partition_counters(p, counters, metrics);
+
+        if(tracer != nullptr) {
+          oram_controller->attach_tracer(tracer, p);
+          integrity_controller->attach_tracer(tracer, p);
+        }
+
+        std::string filename = fmt::format("stash_occupancy_{}_{}_{}_{}_{}_{}_{}_{}", length_tree, block_size, z_blocks, arity, stash_size, encrypt_delay, hash_delay, num_channels);
+        if(num_partitions > 1) {
+          filename += fmt::format("_p{}", p);
+        }
+        std::string trace_config = fmt::format("length_tree={};block_size={};z_blocks={};arity={};stash_size={};encrypt_delay={};decrypt_delay={};hash_delay={};channels={};partition={};sampling={}",
+                                               length_tree, block_size, z_blocks, arity, stash_size, encrypt_delay, decrypt_delay, hash_delay, num_channels, p, stash_trace_sampling);
+        static_cast<ORAMController*>(oram_controller)->stash_trace.open(filename + ".bin", trace_config, stash_trace_sampling, stash_trace_async);
+
+        oram_tree_infos.push_back(oram_tree_info);
+        oram_controllers.push_back(oram_controller);
+        integrity_controllers.push_back(integrity_controller);
+        counter_caches.push_back(counter_cache);
+      }
+
+      register_stat(rng_seed).name("rng_seed");
+      register_stat(warmup_end_cycle).name("warmup_end_cycle");
+      register_stat(traffic_total_bytes).name("oram_traffic_total_bytes");
+      register_stat(traffic_useful_bytes).name("oram_traffic_useful_bytes");
+      register_stat(bandwidth_amplification).name("oram_bandwidth_amplification");
+      register_stat(peak_bandwidth_gbps).name("oram_peak_bandwidth_gbps");
+      register_stat(achieved_bandwidth_gbps).name("oram_achieved_bandwidth_gbps");
+      register_stat(peak_bandwidth_fraction).name("oram_peak_bandwidth_fraction");
+
+      if(sampling.is_enabled()) {
+        sampling.set_counters(pathoram_counters);
+        sampling.set_metrics(pathoram_metrics);
+      }
+      if(num_sources > 1) {
+        source_throughput.assign(num_sources, 0);
+        source_avg_latency.assign(num_sources, 0);
+        for(int s = 0; s < num_sources; s++) {
+          pathoram_metrics.insert({fmt::format("source{}_throughput", s), source_throughput[s]});
+          pathoram_metrics.insert({fmt::format("source{}_avg_latency", s), source_avg_latency[s]});
+        }
+      }
+      if(num_partitions > 1) {
+        pathoram_counters.insert({"router_migrations", num_migrations});
+        pathoram_counters.insert({"router_deferred_migrations", num_deferred_migrations});
+        pathoram_counters.insert({"router_skipped_migrations", num_skipped_migrations});
+      }
+
+      #if PATHORAM_PROFILE
+      for(int i = 0; i < HostProfiler::num_scopes; i++) {
+        HostProfiler::Slot& slot = HostProfiler::slot(static_cast<ProfileScope>(i));
+        pathoram_counters.insert({fmt::format("profile_{}_calls", HostProfiler::scope_names[i]), slot.calls});
+        pathoram_counters.insert({fmt::format("profile_{}_cycles", HostProfiler::scope_names[i]), slot.cycles});
+      }
+      // The host cycles not spent in system_tick are spent in the frontend and in the main loop
+      pathoram_counters.insert({"profile_total_cycles", profile_total_cycles});
+      pathoram_metrics.insert({"profile_host_seconds", profile_host_seconds});
+      pathoram_metrics.insert({"profile_simulated_cycles_per_host_second", profile_cycles_per_host_second});
+      #endif
+
+      for(auto e : pathoram_counters) {
+        register_stat(e.second).name(e.first);
+      }
+      for(auto e : pathoram_metrics) {
+        register_stat(e.second).name(e.first);
+      }
+    };
+
+    void setup(IFrontEnd* frontend, IMemorySystem* memory_system) override {}
+
+    bool send(Request req) override {
+      if(sampling.is_enabled() && warmed_up && sampling.get_mode() != SampledSimulation::Mode::Detailed) {
+        return fast_forward(req);
+      }
+
+      int partition = 0;
+      if(num_partitions > 1) {
+        partition = route(req.addr);
+      }
+
+      // Send and buffer the requested block in the ORAM Controller of its partition
+      bool is_success = oram_controllers[partition]->send(req);
+
+      if(is_success) {
+        if(num_partitions > 1) {
+          // Track the outstanding requests of the block to know when it can migrate
+          outstanding_reqs[req.addr]++;
+        }
+        if(sampling.is_enabled() && warmed_up && sampling.on_detailed_request()) {
+          sampling.begin_measurement(m_clk, sum_counters("oram_controller_replies"), sum_counters("oram_controller_cumulative_latency"));
+        }
+        
+        #if LOG_REQS
+        //type_id is 0 for read, 1 for write
+        std::cout<< "Received type_id "<< req.type_id <<" request for "<< req.addr << std::endl;
+        #endif
+
+        switch (req.type_id) {
+          case Request::Type::Read: {
+            s_num_read_requests++;
+            break;
+          }
+          case Request::Type::Write: {
+            s_num_write_requests++;
+            break;
+          }
+          default: {
+            s_num_other_requests++;
+            break;
+          }
+        }
+      }
+      return is_success;
+    };
+
+    void tick() override {
+      #if PATHORAM_PROFILE
+      if(m_clk == 0) {
+        profile_start_cycles = HostProfiler::now();
+        HostProfiler::elapsed_seconds();
+      } else if(m_clk % 4096 == 0) {
+        update_profile_report();
+      }
+      #endif
+      PATHORAM_PROFILE_SCOPE(SystemTick);
+
+      m_clk++;
+      m_dram->tick();
+      {
+        PATHORAM_PROFILE_SCOPE(DRAMControllers);
+        for (auto controller : m_controllers) {
+          controller->tick();
+        }
+      }
+      for (int p = 0; p < num_partitions; p++) {
+        static_cast<IntegrityController*>(integrity_controllers[p])->tick();
+        static_cast<ORAMController*>(oram_controllers[p])->tick();
+      }
+      if(sampling.is_enabled()) {
+        update_sampling();
+      }
+
+      if(!warmed_up && ((warmup_cycles > 0 && m_clk >= warmup_cycles) ||
+                        (warmup_requests > 0 && (size_t)(s_num_read_requests + s_num_write_requests) >= warmup_requests))) {
+        end_warmup();
+      }
+      if(m_clk % 1024 == 0) {
+        update_traffic_report();
+        if(num_sources > 1) {
+          update_source_report();
+        }
+      }
+      if(epoch_cycles > 0 && m_clk % epoch_cycles == 0) {
+        write_epoch_snapshot();
+      }
+    };
+
+    /**
+     * @brief The derived metrics are refreshed periodically during the run: refresh them at the end,
+     * before the statistics are printed.
+     */
+    void finalize() override {
+      update_traffic_report();
+      if(num_sources > 1) {
+        update_source_report();
+      }
+      if(sampling.is_enabled()) {
+        sampling.refresh();
+      }
+      #if PATHORAM_PROFILE
+      update_profile_report();
+      #endif
+      Implementation::finalize();
+    }
+
+    float get_tCK() override {
+      return m_dram->m_timing_vals("tCK_ps") / 1000.0f;
+    }
+
+    // const SpecDef& get_supported_requests() override {
+    //   return m_dram->m_requests;
+    // };
+
+    ~PathORAMSystem() {
+        for (int p = 0; p < num_partitions; p++) {
+          delete oram_controllers[p];
+          delete integrity_controllers[p];
+          delete counter_caches[p];
+          delete oram_tree_infos[p];
+        }
+        delete tracer;
+    }
+};
+  
+}   // namespace 
+